@@ -4,16 +4,57 @@
 #include <gui/canvas.h>
 #include <gui/gui.h>
 #include "src/util/buffer.h"
-#include "src/util/list.h"
 #include "src/util/card.h"
+#include "src/util/sequencer.h"
+#include "src/util/scheduler.h"
+#include "src/util/frame_watchdog.h"
+#include "src/util/winnable_deals.h"
+#include "src/util/rating.h"
+#include "src/util/hint.h"
 #include <notification/notification.h>
 
+typedef enum {
+    SceneMain,
+    SceneIntro,
+    ScenePlay,
+    SceneSolve,
+    SceneFalling,
+    SceneResult,
+    SceneCount,
+    SceneNone = 0xFF,
+} SceneId;
+
+typedef enum {
+    DealRandom,
+    //only seeds from the winnable table
+    DealWinnable,
+    //one winnable seed per calendar day, rated while it is dealt
+    DealDaily,
+    DealModeCount,
+} DealMode;
+
+//search space of the background jobs, the daily rating uses it while the deal is animated and the hint during play
+typedef union {
+    Rating rating;
+    Hint hint;
+} Search;
+
 typedef struct {
-    Card *card;
+    //CARD_NONE when nothing is animated
+    Card card;
     Vector position;
     Vector velocity;
 } AnimatedCard;
 
+//cards picked up by the player, they stay on top of their source pile until they are placed
+typedef struct {
+    uint8_t pile;
+    uint8_t start;
+    uint8_t count;
+    //piles the hand can be placed on, worked out when it is picked up
+    uint16_t targets;
+} Hand;
+
 typedef struct {
     Canvas *canvas;
     Gui *gui;
@@ -23,17 +64,24 @@ typedef struct {
     bool isDirty;
     bool clearBuffer;
     bool lateRender;
-    uint8_t scene_switch;
+    SceneId next_scene;
     Buffer *buffer;
     NotificationApp *notification_app;
+    Sequencer *sequencer;
     uint8_t selected[2];
     uint8_t selected_card;
 
-    List *deck;
-    List *waste;
-    List *hand;
-    List *foundation[4];
-    List *tableau[7];
+    Klondike game;
+    Hand hand;
+
+    Scheduler scheduler;
+    //allocated at startup so neither search touches the heap once the game runs
+    Search *search;
+    FrameWatchdog watchdog;
+    DeckShuffle next_deal;
+    DealMode deal_mode;
+    //how hard the daily deal is, RatingNone in the other modes or when the deal animation was cut short
+    RatingLevel deal_rating;
 
     AnimatedCard animated_card;
     double delta_time;
@@ -1,16 +1,23 @@
+#include <inttypes.h>
 #include <furi.h>
 #include <gui/gui.h>
 #include <input/input.h>
 #include <notification/notification_messages.h>
 
 #include "game_state.h"
-#include "src/util/list.h"
 #include "src/scene/scene_setup.h"
 #include "src/util/helpers.h"
+#include "src/util/rules.h"
 
-static List *game_logic;
-static ListItem *current_state;
+//~60 fps worth of cpu cycles
+#define FRAME_CYCLES (64000000 / 60)
+
+static SceneId current_scene = SceneMain;
 static FuriMutex *update_mutex;
+//cpu cycle when the pending scene switch was requested, used to report the transition latency
+static size_t transition_start = 0;
+//scene the pending transition started from
+static SceneId transition_from = SceneNone;
 
 static void gui_input_events_callback(const void *value, void *ctx) {
     furi_mutex_acquire(update_mutex, FuriWaitForever);
@@ -22,40 +29,59 @@ static void gui_input_events_callback(const void *value, void *ctx) {
         instance->exit = true;
     }
 
-    if (current_state) {
-        ((GameLogic *) current_state->data)->input(instance, event->key, event->type);
+    scenes[current_scene].input(instance, event->key, event->type);
+    if (instance->next_scene != SceneNone && !transition_start) {
+        transition_start = curr_time();
     }
     furi_mutex_release(update_mutex);
 }
 
 
-static GameState *prepare() {
-    game_logic = list_make();
-    update_mutex = (FuriMutex *) furi_mutex_alloc(FuriMutexTypeNormal);
+static void enter_scene(GameState *instance, SceneId scene) {
+    current_scene = scene;
+    const GameLogic *logic = &(scenes[scene]);
+    logic->enter(instance);
 
-    //Add scenes to the logic list
-    list_push_back(&main_screen, game_logic);
-    list_push_back(&intro_screen, game_logic);
-    list_push_back(&play_screen, game_logic);
-    list_push_back(&solve_screen, game_logic);
-    list_push_back(&falling_screen, game_logic);
-    list_push_back(&result_screen, game_logic);
+    //let the upcoming scene warm up its resources while this one is running
+    if (logic->preload != SceneNone && scenes[logic->preload].prepare) {
+        scenes[logic->preload].prepare(instance);
+    }
+}
 
-    current_state = game_logic->head;
+static void switch_scene(GameState *instance) {
+    SceneId from = current_scene;
+    SceneId to = instance->next_scene;
+    instance->next_scene = SceneNone;
+    if (to >= SceneCount) return;
 
-    GameState *instance = malloc(sizeof(GameState));
-    ((GameLogic *) current_state->data)->start(instance);
-
-    instance->hand = list_make();
-    instance->deck = list_make();
-    instance->waste = list_make();
-    for (int i = 0; i < 7; i++) {
-        if (i < 4) {
-            instance->foundation[i] = list_make();
-        }
-        instance->tableau[i] = list_make();
+    FURI_LOG_D("SCENE", "%s -> %s", scenes[from].name, scenes[to].name);
+    alloc_stats_scene(scenes[from].name);
+    if (scenes[from].exit) {
+        scenes[from].exit(instance);
     }
+    enter_scene(instance, to);
+}
 
+static GameState *prepare() {
+    update_mutex = (FuriMutex *) furi_mutex_alloc(FuriMutexTypeNormal);
+
+    GameState *instance = malloc(sizeof(GameState));
+    instance->next_scene = SceneNone;
+    scheduler_init(&instance->scheduler);
+    instance->search = malloc(sizeof(Search));
+    watchdog_init(&instance->watchdog, FRAME_CYCLES);
+#ifdef DEBUG_BUILD
+    uint16_t rule_errors = rules_self_check();
+    if (rule_errors) FURI_LOG_E("RULES", "%u rule table entries disagree with the card rules", rule_errors);
+#endif
+    instance->next_deal.position = 0;
+    instance->next_deal.ready = false;
+    instance->deal_mode = DealRandom;
+    instance->deal_rating = RatingNone;
+
+    board_clear(&instance->game.board);
+    instance->hand.count = 0;
+    instance->animated_card.card = CARD_NONE;
     instance->animated_card.position = VECTOR_ZERO;
     instance->animated_card.velocity = VECTOR_ZERO;
 
@@ -66,7 +92,10 @@ static GameState *prepare() {
     instance->canvas = gui_direct_draw_acquire(instance->gui);
     instance->notification_app = (NotificationApp *) furi_record_open(RECORD_NOTIFICATION);
     notification_message_block(instance->notification_app, &sequence_display_backlight_enforce_on);
+    instance->sequencer = sequencer_alloc(instance->notification_app);
+    alloc_stats_scene("startup");
 
+    enter_scene(instance, SceneMain);
 
     instance->input_subscription =
         furi_pubsub_subscribe(instance->input, gui_input_events_callback, instance);
@@ -76,17 +105,12 @@ static GameState *prepare() {
 
 static void cleanup(GameState *instance) {
     furi_pubsub_unsubscribe(instance->input, instance->input_subscription);
-    notification_message_block(instance->notification_app, &sequence_display_backlight_enforce_auto);
-
-    list_free(instance->hand);
-    list_free(instance->deck);
-    list_free(instance->waste);
-    for (int i = 0; i < 7; i++) {
-        if (i < 4) {
-            list_free(instance->foundation[i]);
-        }
-        list_free(instance->tableau[i]);
+    if (scenes[current_scene].exit) {
+        scenes[current_scene].exit(instance);
     }
+    free(instance->search);
+    sequencer_free(instance->sequencer);
+    notification_message_block(instance->notification_app, &sequence_display_backlight_enforce_auto);
 
     furi_mutex_free(update_mutex);
     instance->canvas = NULL;
@@ -95,29 +119,67 @@ static void cleanup(GameState *instance) {
     furi_record_close(RECORD_INPUT_EVENTS);
     furi_record_close(RECORD_NOTIFICATION);
 
-    list_clear(game_logic);
-    free(game_logic);
     buffer_release(instance->buffer);
     free(instance);
 }
 
-static void next_scene(GameState *instance) {
-    FURI_LOG_W("SCENE", "Next scene");
-    current_state = current_state->next;
-    if (current_state == NULL) {
-        current_state = game_logic->head;
+//update, scene switch and render of one frame, without the mutex and the background jobs. The host tools run the
+//same frames, render false skips the drawing for them
+//returns true when the first frame of a new scene was done, latency then holds the cycles since the input or update
+//that asked for the switch
+static bool run_frame(GameState *instance, size_t frame_start, bool render, uint32_t *latency) {
+    bool switched = false;
+    scenes[current_scene].update(instance);
+    if (instance->next_scene != SceneNone) {
+        if (!transition_start) transition_start = frame_start;
+        transition_from = current_scene;
+        switch_scene(instance);
     }
-    ((GameLogic *) current_state->data)->start(instance);
-}
+    size_t renderStart = curr_time();
+    const GameLogic *curr_state = &(scenes[current_scene]);
+    check_pointer(instance);
+    check_pointer(instance->canvas);
+    check_pointer(instance->buffer);
+    if (instance->isDirty && instance->canvas && instance->buffer) {
+        if (render) {
+            canvas_reset(instance->canvas);
 
-static void prev_scene(GameState *instance) {
-    FURI_LOG_W("SCENE", "Prev scene");
-    current_state = game_logic->head;
-    if (current_state->prev == NULL) {
-        instance->exit = true;
-        return;
+            if(instance->lateRender){
+                buffer_swap_back(instance->buffer);
+                buffer_render(instance->buffer, instance->canvas);
+                curr_state->render(instance);
+            }else{
+                buffer_swap_back(instance->buffer);
+                curr_state->render(instance);
+                buffer_render(instance->buffer, instance->canvas);
+            }
+            size_t presentStart = curr_time();
+            canvas_commit(instance->canvas);
+
+            //tell the scenes to go easier on the cpu when frames keep running late
+            if (watchdog_frame(&instance->watchdog, renderStart - frame_start, presentStart - renderStart,
+                               curr_time() - presentStart)) {
+                card_set_quality(instance->watchdog.quality);
+            }
+
+            if (instance->clearBuffer)
+                buffer_clear(instance->buffer);
+        }
+
+        if (transition_start) {
+            uint32_t cycles = curr_time() - transition_start;
+            FURI_LOG_I("SCENE", "%s first frame after %" PRIu32 "us", curr_state->name, cycles / 64);
+            if (latency) *latency = cycles;
+            transition_start = 0;
+            switched = true;
+        }
+
+        instance->clearBuffer = true;
+        instance->lateRender = false;
+        instance->isDirty = false;
     }
-    ((GameLogic *) current_state->data)->start(instance);
+    alloc_stats_frame(curr_state->name);
+    return switched;
 }
 
 static void direct_draw_run(GameState *instance) {
@@ -132,45 +194,17 @@ static void direct_draw_run(GameState *instance) {
         FuriStatus status = furi_mutex_acquire(update_mutex, 20);
         if (!status) continue;
 
-        GameLogic *curr_state = (GameLogic *) current_state->data;
         currFrameTime = curr_time();
         instance->delta_time = (currFrameTime - lastFrameTime) / 64000000.0f;
         lastFrameTime = currFrameTime;
 
-        check_pointer(curr_state);
-        curr_state->update(instance);
-        if (instance->scene_switch == 1) {
-            next_scene(instance);
-        } else if (instance->scene_switch == 2) {
-            prev_scene(instance);
-        }
-        check_pointer(curr_state);
-        check_pointer(instance);
-        check_pointer(instance->canvas);
-        check_pointer(instance->buffer);
-        instance->scene_switch = 0;
-        if (curr_state && instance->isDirty && instance->canvas && instance->buffer) {
-            canvas_reset(instance->canvas);
-
-            if(instance->lateRender){
-                buffer_swap_back(instance->buffer);
-                buffer_render(instance->buffer, instance->canvas);
-                curr_state->render(instance);
-            }else{
-                buffer_swap_back(instance->buffer);
-                curr_state->render(instance);
-                buffer_render(instance->buffer, instance->canvas);
-            }
-            canvas_commit(instance->canvas);
-
-            if (instance->clearBuffer)
-                buffer_clear(instance->buffer);
-
-            instance->clearBuffer = true;
-            instance->lateRender = false;
-            instance->isDirty = false;
-        }
+        run_frame(instance, currFrameTime, true, NULL);
         furi_mutex_release(update_mutex);
+
+        //spend what is left from the frame on background jobs, outside the mutex so input isn't held up by them
+        uint32_t frame_cost = curr_time() - currFrameTime;
+        if (frame_cost < FRAME_CYCLES)
+            scheduler_run(&instance->scheduler, FRAME_CYCLES - frame_cost);
         furi_thread_yield();
     } while (!instance->exit);
 }
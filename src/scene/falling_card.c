@@ -1,18 +1,8 @@
-#include <notification/notification.h>
-#include <notification/notification_messages.h>
 #include "falling_card.h"
 #include "../../game_state.h"
 #include "play_screen.h"
 #include "../util/helpers.h"
 
-static const NotificationSequence sequence_bounce = {
-    &message_vibro_on,
-//    &message_note_c4,
-    &message_delay_10,
-    &message_vibro_off,
-//    &message_sound_off,
-    NULL,
-};
 static uint8_t start_index = 0;
 static size_t tempTime = 0;
 
@@ -28,9 +18,15 @@ void start_falling_screen(void *data) {
     state->game_end = furi_get_tick();
 }
 
+void end_falling_screen(void *data) {
+    GameState *state = (GameState *) data;
+    //remove card that is currently animated
+    state->animated_card.card = CARD_NONE;
+}
+
 void render_falling_screen(void *data) {
     GameState *state = (GameState *) data;
-    if (state->animated_card.card != NULL) {
+    if (state->animated_card.card != CARD_NONE) {
         card_render_front(state->animated_card.card, state->animated_card.position.x, state->animated_card.position.y,
                           false, state->buffer, 22);
     }
@@ -42,7 +38,7 @@ void update_falling_screen(void *data) {
     state->clearBuffer = false;
     state->isDirty = true;
 
-    if (state->animated_card.card) {
+    if (state->animated_card.card != CARD_NONE) {
 
         if ((curr_time() - tempTime) > 12) {
             tempTime = curr_time();
@@ -53,7 +49,7 @@ void update_falling_screen(void *data) {
             if (state->animated_card.position.y > 41) {
                 state->animated_card.velocity.y *= -0.8f;
                 state->animated_card.position.y = 41;
-                notification_message(state->notification_app, (const NotificationSequence *) &sequence_bounce);
+                sequencer_cue(state->sequencer, CueBounce);
             } else {
                 state->animated_card.velocity.y--;
                 if (state->animated_card.velocity.y < -10) state->animated_card.velocity.y = -10;
@@ -61,20 +57,19 @@ void update_falling_screen(void *data) {
 
             //delete the card if it is outside the screen
             if (state->animated_card.position.x < -18 || state->animated_card.position.x > 128) {
-                free(state->animated_card.card);
-                state->animated_card.card = NULL;
+                state->animated_card.card = CARD_NONE;
             }
         }
 
     } else {
         //When we find a foundation without any card means that we finished the animation
-        if (state->foundation[start_index]->count == 0) {
-            state->scene_switch = 1;
+        if (board_count(&state->game.board, PILE_FOUNDATION(start_index)) == 0) {
+            state->next_scene = SceneResult;
             return;
         }
 
         //start with the next card
-        state->animated_card.card = list_pop_back(state->foundation[start_index]);
+        state->animated_card.card = board_pop(&state->game.board, PILE_FOUNDATION(start_index));
         state->animated_card.position = (Vector) {56 + start_index * 18, 1};
 
         float r1 = 2.0 * (float) (rand() % 2) - 1.0; // random number in range -1 to 1
@@ -93,11 +88,6 @@ void update_falling_screen(void *data) {
 void input_falling_screen(void *data, InputKey key, InputType type) {
     GameState *state = (GameState *) data;
     if (key == InputKeyOk && type == InputTypePress) {
-        //remove card that is currently animated
-        if (state->animated_card.card != NULL) {
-            free(state->animated_card.card);
-            state->animated_card.card = NULL;
-        }
-        state->scene_switch = 1;
+        state->next_scene = SceneResult;
     }
 }
\ No newline at end of file
@@ -4,6 +4,8 @@
 
 void start_falling_screen(void *data);
 
+void end_falling_screen(void *data);
+
 void render_falling_screen(void *data);
 
 void update_falling_screen(void *data);
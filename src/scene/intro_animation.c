@@ -1,6 +1,7 @@
 #include "./intro_animation.h"
 
 #include <dolphin/dolphin.h>
+#include <furi_hal.h>
 
 #include "../../game_state.h"
 #include "../util/helpers.h"
@@ -11,16 +12,69 @@ static int8_t curr_tableau = 0;
 static Vector animation_target = VECTOR_ZERO;
 static Vector animation_from = VECTOR_ZERO;
 static double accumulated_delta = 0;
+static bool rating_running = false;
 
 void start_animation(GameState *state) {
     accumulated_delta = 0;
-    check_pointer(state->deck->tail);
-    state->animated_card.card = list_peek_back(state->deck);
-    check_pointer(state->animated_card.card);
+    state->animated_card.card = board_peek(&state->game.board, PileDeck);
     animation_from = (Vector) {2, 1};
     animation_target.x = 2.0f + (float) curr_tableau * 18;
-    check_pointer(state->tableau[curr_tableau]);
-    animation_target.y = MIN(25.0f + (float) state->tableau[curr_tableau]->count * 4, 36);
+    animation_target.y = MIN(25.0f + (float) board_count(&state->game.board, PILE_TABLEAU(curr_tableau)) * 4, 36);
+}
+
+//background job: shuffles the next deal
+static bool prepare_step(void *data) {
+    GameState *state = (GameState *) data;
+    return deck_shuffle_step(&state->next_deal);
+}
+
+//winnable deals are picked from the seeds the solver proved on the host, no search needed here
+//the daily deal only depends on the date, so everybody plays the same one
+static uint32_t deal_seed(GameState *state) {
+    DateTime date;
+    switch (state->deal_mode) {
+        case DealWinnable:
+            return winnable_pick(curr_time());
+        case DealDaily:
+            furi_hal_rtc_get_datetime(&date);
+            return winnable_daily(date.year, date.month, date.day);
+        default:
+            return curr_time();
+    }
+}
+
+void prepare_intro_screen(void *data) {
+    GameState *state = (GameState *) data;
+    //the scenes that preload the intro don't draw the board, the last game can go right away
+    board_clear(&state->game.board);
+    if (state->next_deal.position == 0)
+        deck_shuffle_start(&state->next_deal, deal_seed(state));
+    scheduler_add(&state->scheduler, prepare_step, state);
+}
+
+void reshuffle_intro_deal(void *data) {
+    GameState *state = (GameState *) data;
+    scheduler_cancel(&state->scheduler, prepare_step, state);
+    deck_shuffle_start(&state->next_deal, deal_seed(state));
+    scheduler_add(&state->scheduler, prepare_step, state);
+}
+
+//the daily deal is rated in the background while it is dealt, the search only gets the frame time the animation
+//leaves over, in slices the scheduler fits into it
+static void start_deal_rating(GameState *state) {
+    state->deal_rating = RatingNone;
+    if (state->deal_mode != DealDaily || !check_pointer(state->search)) return;
+    rating_start(&state->search->rating, &state->game);
+    rating_running = scheduler_add(&state->scheduler, rating_step, &state->search->rating);
+    if (!rating_running) FURI_LOG_W("INTRO", "Daily deal left unrated");
+}
+
+//the search is over with the animation, play needs the frame time and the hint the search space
+static void end_deal_rating(GameState *state) {
+    if (!rating_running) return;
+    rating_running = false;
+    scheduler_cancel(&state->scheduler, rating_step, &state->search->rating);
+    state->deal_rating = rating_level(&state->search->rating);
 }
 
 void start_intro_screen(void *data) {
@@ -28,38 +82,37 @@ void start_intro_screen(void *data) {
     animation_running = true;
     dolphin_deed(DolphinDeedPluginGameStart);
     GameState *state = (GameState *) data;
-    check_pointer(state->deck);
-    list_free(state->deck);
-    check_pointer(state->hand);
-    list_free_data(state->hand);
-    check_pointer(state->waste);
-    list_free_data(state->waste);
-    for (int i = 0; i < 7; i++) {
-        if (i < 4) {
-            check_pointer(state->foundation[i]);
-            list_free_data(state->foundation[i]);
-        }
-        check_pointer(state->tableau[i]);
-        list_free_data(state->tableau[i]);
-    }
 
-    state->deck = deck_generate(1);
-    check_pointer(state->deck->tail);
+    //usually done while the previous screen was idle, otherwise finish it here
+    scheduler_cancel(&state->scheduler, prepare_step, state);
+    if (state->next_deal.position == 0)
+        deck_shuffle_start(&state->next_deal, deal_seed(state));
+    while (!prepare_step(state));
+
+    deck_from_shuffle(&state->next_deal, &state->game);
+    start_deal_rating(state);
     start_animation(state);
 }
 
+void end_intro_screen(void *data) {
+    GameState *state = (GameState *) data;
+    end_deal_rating(state);
+    state->animated_card.card = CARD_NONE;
+}
+
 void render_intro_screen(void *data) {
 
     GameState *state = (GameState *) data;
     render_play_screen(data);
 
-    if (state->animated_card.card) {
+    if (state->animated_card.card != CARD_NONE) {
         card_render_back(state->animated_card.position.x, state->animated_card.position.y, false, state->buffer, 22);
     }
 }
 
 static bool animation_done(GameState *state) {
-    accumulated_delta += state->delta_time * 4;
+    //fewer intermediate frames when the device can't keep up
+    accumulated_delta += state->delta_time * (state->watchdog.quality == QualityMinimal ? 8 : 4);
     vector_lerp(&(animation_from), &animation_target, accumulated_delta,
                 &(state->animated_card.position));
     double dist = vector_distance(&(state->animated_card.position), &animation_target);
@@ -72,37 +125,31 @@ void update_intro_screen(void *data) {
     if (curr_tableau < 7 && animation_running) {
         if (animation_done(state)) {
             if (curr_tableau < 7) {
-                check_pointer(state->deck);
-                check_pointer(state->deck->tail);
-                check_pointer(state->tableau);
-                check_pointer(state->tableau[curr_tableau]);
-                list_push_back(list_pop_back(state->deck), state->tableau[curr_tableau]);
-                if ((curr_tableau + 1) == (uint8_t) state->tableau[curr_tableau]->count) {
-                    Card *c = ((Card *) list_peek_back(state->tableau[curr_tableau]));
-                    check_pointer(c);
-                    c->exposed = true;
+                bool column_done = klondike_deal_card(&state->game, curr_tableau);
+                //under load deal the whole column with a single animation
+                if (state->watchdog.quality == QualityMinimal) {
+                    while (!column_done) column_done = klondike_deal_card(&state->game, curr_tableau);
+                }
+                if (column_done) {
                     curr_tableau++;
                 }
-                start_animation(state);
+                if (curr_tableau < 7)
+                    start_animation(state);
+                else
+                    state->animated_card.card = CARD_NONE;
             }
         }
     } else {
-        state->animated_card.card = NULL;
-        state->scene_switch = 1;
+        state->next_scene = ScenePlay;
         return;
     }
 }
 
 static void quick_finish(GameState *state) {
-    if (state->animated_card.card) {
-        list_push_back(list_pop_back(state->deck), state->tableau[curr_tableau]);
-    }
+    state->animated_card.card = CARD_NONE;
 
     while (curr_tableau < 7) {
-        while ((uint8_t) (state->tableau[curr_tableau]->count) < (curr_tableau + 1)) {
-            list_push_back(list_pop_back(state->deck), state->tableau[curr_tableau]);
-        }
-        ((Card *) list_peek_back(state->tableau[curr_tableau]))->exposed = true;
+        while (!klondike_deal_card(&state->game, curr_tableau));
         curr_tableau++;
     }
     animation_running = false;
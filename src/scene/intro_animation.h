@@ -2,9 +2,17 @@
 #include <furi.h>
 #include <input/input.h>
 
+//clears the last game and shuffles the next deal in the background
+void prepare_intro_screen(void *data);
+
+//starts the background shuffle over with a new seed, after the deal mode changed
+//the shuffle job runs on the main thread, so this has to be called from an update, not from input
+void reshuffle_intro_deal(void *data);
 
 void start_intro_screen(void *data);
 
+void end_intro_screen(void *data);
+
 void render_intro_screen(void *data);
 
 void update_intro_screen(void *data);
@@ -1,130 +1,80 @@
-#include <notification/notification_messages.h>
 #include "main_screen.h"
+#include "intro_animation.h"
 
 static bool is_dirty = false;
-static size_t last_start = 0;
-static int8_t note = 0;
-static const float VOLUME = 0.25f;
-
-static const NotificationMessage note_e4 = {
-    .type = NotificationMessageTypeSoundOn,
-    .data.sound.frequency = 329.63f,
-    .data.sound.volume = VOLUME,
-};
-
-static const NotificationMessage note_g4 = {
-    .type = NotificationMessageTypeSoundOn,
-    .data.sound.frequency = 392.0f,
-    .data.sound.volume = VOLUME,
-};
-
-static const NotificationMessage note_c5 = {
-    .type = NotificationMessageTypeSoundOn,
-    .data.sound.frequency = 523.25f,
-    .data.sound.volume = VOLUME,
-};
-
-static const NotificationMessage note_d4 = {
-    .type = NotificationMessageTypeSoundOn,
-    .data.sound.frequency = 293.66f,
-    .data.sound.volume = VOLUME,
-};
-
-static const NotificationMessage note_f4 = {
-    .type = NotificationMessageTypeSoundOn,
-    .data.sound.frequency = 349.23f,
-    .data.sound.volume = VOLUME,
-};
-
-static const NotificationMessage note_b4 = {
-    .type = NotificationMessageTypeSoundOn,
-    .data.sound.frequency = 493.88f,
-    .data.sound.volume = VOLUME,
-};
-
-static const NotificationMessage *music_notes[] = {
-    &note_e4,
-    &note_g4,
-    &note_c5,
-    &message_sound_off,
-    &note_g4,
-    &message_sound_off,
-
-    &note_e4,
-    &note_g4,
-    &note_c5,
-    &message_sound_off,
-    &note_g4,
-    &message_sound_off,
-
-    &note_d4,
-    &note_f4,
-    &note_b4,
-    &message_sound_off,
-    &note_f4,
-    &message_sound_off,
-
-    &note_d4,
-    &note_f4,
-    &note_b4,
-    &message_sound_off,
-    &note_f4,
-    &message_sound_off,
+//set by input, the next deal is reshuffled by the update so it never races the shuffle job
+static bool reshuffle = false;
+
+//E4 G4 C5 - G4 - twice, then D4 F4 B4 - F4 - twice
+static const uint8_t menu_rows[] = {
+    64, 67, 72, 0, 67, 0,
+    64, 67, 72, 0, 67, 0,
+    62, 65, 71, 0, 65, 0,
+    62, 65, 71, 0, 65, 0,
 };
 
-static NotificationSequence music = {
-    NULL,
-    &message_delay_250,
-    &message_sound_off,
-    NULL
+static const SequencerPattern menu_music = {
+    .rows=menu_rows,
+    .length=sizeof(menu_rows),
+    .row_ms=250,
+    .volume=0.25f,
 };
 
 
 void start_main_screen(void *data) {
     is_dirty = true;
+    reshuffle = false;
     GameState *state = (GameState *) data;
-    last_start=0;
-    note = -1;
-    state->lateRender = false;
-    state->isDirty = true;
-    state->clearBuffer = true;
-}
+    sequencer_play(state->sequencer, &menu_music);
 
-void render_main_screen(void *data) {
-    GameState *state = (GameState *) data;
+    //the artwork stays in the buffer, only the deal mode is drawn on top
     Vector logo_pos = (Vector) {60, 30};
     Vector main_img_pos = (Vector) {115, 25};
     Vector start_text_pos = (Vector) {64, 55};
+    buffer_clear(state->buffer);
     buffer_draw_all(state->buffer, (Buffer *) &sprite_logo, &logo_pos, 0);
     buffer_draw_all(state->buffer, (Buffer *) &sprite_main_image, &main_img_pos, 0);
     buffer_draw_all(state->buffer, (Buffer *) &sprite_start, &start_text_pos, 0);
+    state->lateRender = true;
+    state->isDirty = true;
+    state->clearBuffer = false;
 }
 
-void update_main_screen(void *data) {
+void end_main_screen(void *data) {
     GameState *state = (GameState *) data;
-    UNUSED(state);
-    size_t t = curr_time();
-    //Play the menu music one note at a time to not block the app
-    if ((last_start - t) > 250) {
-        if(note>=0) {
-            music[0] = music_notes[note];
-
-            notification_message_block(state->notification_app, (const NotificationSequence *) &music);
+    sequencer_stop(state->sequencer);
+    buffer_clear(state->buffer);
+}
 
-            last_start = t;
-        }
-        note = (note+1)%24;
-    }
+void render_main_screen(void *data) {
+    GameState *state = (GameState *) data;
+    static const char *mode_names[DealModeCount] = {"Deal: random", "Deal: winnable", "Deal: daily"};
+    canvas_set_font(state->canvas, FontSecondary);
+    canvas_draw_str_aligned(state->canvas, 2, 1, AlignLeft, AlignTop, mode_names[state->deal_mode]);
+}
 
+void update_main_screen(void *data) {
+    GameState *state = (GameState *) data;
     state->isDirty = is_dirty;
+    state->lateRender = true;
+    state->clearBuffer = false;
     is_dirty = false;
-
+    if (reshuffle) {
+        reshuffle = false;
+        reshuffle_intro_deal(state);
+    }
 }
 
 void input_main_screen(void *data, InputKey key, InputType type) {
     GameState *state = (GameState *) data;
 
     if (key == InputKeyOk && type == InputTypePress) {
-        state->scene_switch = 1;
+        state->next_scene = SceneIntro;
+    } else if ((key == InputKeyUp || key == InputKeyDown) && type == InputTypePress) {
+        //Up goes to the next mode, Down to the previous one
+        uint8_t step = key == InputKeyUp ? 1 : DealModeCount - 1;
+        state->deal_mode = (DealMode) ((state->deal_mode + step) % DealModeCount);
+        reshuffle = true;
+        is_dirty = true;
     }
 }
\ No newline at end of file
@@ -9,6 +9,8 @@
 
 void start_main_screen(void *data);
 
+void end_main_screen(void *data);
+
 void render_main_screen(void *data);
 
 void update_main_screen(void *data);
@@ -1,4 +1,3 @@
-#include <notification/notification_messages.h>
 #include "./play_screen.h"
 #include "../../game_state.h"
 #include "../util/helpers.h"
@@ -7,130 +6,297 @@
 static bool can_quick_solve = false;
 static bool solved = false;
 static bool started = false;
-int8_t picked_from[2] = {-1, -1};
-static const NotificationSequence sequence_fail = {
-    &message_vibro_on,
-    &message_note_c4,
-    &message_delay_10,
-    &message_vibro_off,
-    &message_sound_off,
-    &message_delay_10,
-
-    &message_vibro_on,
-    &message_note_a3,
-    &message_delay_10,
-    &message_vibro_off,
-    &message_sound_off,
-    NULL,
-};
 
+#define NAVIGATION_QUEUE 8
+static InputKey pending_nav[NAVIGATION_QUEUE];
+static uint8_t pending_count = 0;
+//a direction held past Long walks with every Repeat, let go before the first Repeat it jumps to the edge instead
+static InputKey held_key = InputKeyMAX;
+static bool held_walked = false;
 
-void end_play_screen(GameState *state) {
+//set by input, the search is started by the update so the job only ever sees a copy of the board
+static bool hint_requested = false;
+static bool hint_pending = false;
+//destination of the suggested move, highlighted until the next input
+static uint8_t hint_target = PILE_NONE;
 
-    //put back the card from the hand to allow quick solve
-    if (state->hand->count) {
-        if (picked_from[1] == 1) {
-            while (state->hand->tail) {
-                list_push_back(list_pop_front(state->hand), state->tableau[picked_from[1]]);
-            }
-        }
-        if (picked_from[1] == 0) {
-            list_push_back(list_pop_front(state->hand), state->waste);
-        }
-    }
+//set by every player move, the safe cards then fly to the foundations one after the other
+static bool autoplay = false;
+static Move flying;
+static double flight = 0;
+static Vector flight_from = VECTOR_ZERO;
+static Vector flight_to = VECTOR_ZERO;
 
+void end_play_screen(GameState *state) {
+    //the picked cards never left their pile, dropping the view is enough for quick solve
+    state->hand.count = 0;
     state->selected[0] = 0;
     state->selected[1] = 0;
     started = false;
     solved = false;
-    state->scene_switch = 1;
+    state->next_scene = SceneSolve;
 }
 
 void check_quick_solve(GameState *state) {
-    uint8_t c = 0;
-    for (uint8_t i = 0; i < 7; i++) {
-        Card *front = list_peek_front(state->tableau[i]);
-        if (!front || front->exposed) c++;
-    }
-    can_quick_solve = c == 7;
+    can_quick_solve = klondike_is_revealed(&state->game);
 }
 
 void start_play_screen(void *data) {
     GameState *state = (GameState *) data;
-    picked_from[0] = -1;
-    picked_from[1] = -1;
+    state->hand.count = 0;
     state->selected[0] = 0;
     state->selected[1] = 0;
     state->selected_card = 0;
     state->isDirty = true;
+    pending_count = 0;
+    held_key = InputKeyMAX;
+    hint_requested = false;
+    hint_pending = false;
+    hint_target = PILE_NONE;
+    autoplay = false;
+    state->animated_card.card = CARD_NONE;
     can_quick_solve = false;
     solved = false;
     started = true;
     state->game_start = furi_get_tick();
 }
 
+void exit_play_screen(void *data) {
+    GameState *state = (GameState *) data;
+    scheduler_cancel(&state->scheduler, hint_step, &state->search->hint);
+    hint_requested = false;
+    hint_pending = false;
+    hint_target = PILE_NONE;
+}
+
 bool check_finish(void *data) {
     GameState *state = (GameState *) data;
-    if (state->waste->count > 0 || state->deck->count > 0) return false;
+    return klondike_is_won(&state->game);
+}
 
-    for (uint8_t i = 0; i < 7; i++) {
-        Card *front = list_peek_front(state->tableau[i]);
-        if (front) return false;
-    }
+static void pick(GameState *state, uint8_t pile, uint8_t count) {
+    uint8_t available = board_count(&state->game.board, pile);
+    state->hand.pile = pile;
+    state->hand.count = MIN(count, available);
+    state->hand.start = available - state->hand.count;
+    state->hand.targets = klondike_destinations(&state->game, pile, state->hand.count);
+}
+
+static bool is_picked_from(GameState *state, uint8_t pile) {
+    return state->hand.count > 0 && state->hand.pile == pile;
+}
+
+static bool is_flying(GameState *state) {
+    return autoplay && state->animated_card.card != CARD_NONE;
+}
 
+//cards of the pile that are not in the hand or in the air
+static uint8_t visible_count(GameState *state, uint8_t pile) {
+    if (is_flying(state) && pile == flying.from) return board_count(&state->game.board, pile) - 1;
+    return is_picked_from(state, pile) ? state->hand.start : board_count(&state->game.board, pile);
+}
+
+//applies the move if the rules allow it, the safe cards follow it
+//the hand is dropped first, the safe cards can fly off the pile it was picked from
+static bool try_move(GameState *state, uint8_t type, uint8_t from, uint8_t to, uint8_t count) {
+    Move move = {type, from, to, count};
+    if (!klondike_is_legal(&state->game, &move)) return false;
+    state->hand.count = 0;
+    klondike_apply_move(&state->game, &move);
+    autoplay = true;
     return true;
 }
 
-void reset_picked() {
-    picked_from[0] = -1;
-    picked_from[1] = -1;
+//lifts the card of a safe move off its pile, it is only moved on the board once it lands
+static void take_off(GameState *state, const Move *move) {
+    uint8_t count = board_count(&state->game.board, move->from);
+    flying = *move;
+    flight = 0;
+    if (move->from == PileWaste) {
+        flight_from = (Vector) {20, 1};
+    } else {
+        flight_from.x = 2 + (move->from - PileTableau) * 18;
+        flight_from.y = 25 + MIN(count - 1, 4) * 4;
+    }
+    flight_to = (Vector) {56 + (move->to - PileFoundation) * 18, 1};
+    state->animated_card.card = board_peek(&state->game.board, move->from);
+    state->animated_card.position = flight_from;
+}
+
+//chained to the player move, so a single undo takes back the whole batch
+static void land(GameState *state) {
+    klondike_apply_chained(&state->game, &flying);
+    state->animated_card.card = CARD_NONE;
+}
+
+static void end_autoplay(GameState *state) {
+    autoplay = false;
+    solved = check_finish(state);
+    check_quick_solve(state);
+}
+
+static void step_autoplay(GameState *state) {
+    Move move;
+    if (is_flying(state)) {
+        state->isDirty = true;
+        //fewer intermediate frames when the device can't keep up
+        flight += state->delta_time * (state->watchdog.quality == QualityMinimal ? 8 : 4);
+        vector_lerp(&flight_from, &flight_to, flight, &state->animated_card.position);
+        if (vector_distance(&state->animated_card.position, &flight_to) >= 1) return;
+        land(state);
+    }
+    if (klondike_safe_move(&state->game, &move)) take_off(state, &move);
+    else end_autoplay(state);
+}
+
+//input doesn't wait for the animation, the rest of the batch is played at once
+static void finish_autoplay(GameState *state) {
+    if (!autoplay) return;
+    Move move;
+    if (is_flying(state)) land(state);
+    while (klondike_safe_move(&state->game, &move)) klondike_apply_chained(&state->game, &move);
+    end_autoplay(state);
+    state->isDirty = true;
+}
+
+//the hand only moves cards once they are placed on a new pile
+static bool place_hand(GameState *state, uint8_t pile) {
+    if (!(state->hand.targets & (1 << pile))) return false;
+    return try_move(state, MovePile, state->hand.pile, pile, state->hand.count);
 }
 
-bool is_picked_from(uint8_t x, uint8_t y) {
-    return picked_from[0] == x && picked_from[1] == y;
+//the piles a hand can go to in cursor order, the foundations first, then the tableau columns
+#define TARGET_COUNT 11
+
+static uint8_t target_pile(int8_t index) {
+    return index < 4 ? PILE_FOUNDATION(index) : PILE_TABLEAU(index - 4);
 }
 
-void set_picked_from(int8_t x, int8_t y) {
-    picked_from[0] = x;
-    picked_from[1] = y;
+//moves the cursor to the next pile in direction that takes the hand, false if there is none
+static bool jump_to_target(GameState *state, int8_t direction) {
+    int8_t at;
+    if (state->selected[1] == 1) at = 4 + state->selected[0];
+    else if (state->selected[0] >= 3) at = state->selected[0] - 3;
+    else at = direction > 0 ? -1 : TARGET_COUNT;
+
+    for (uint8_t i = 0; i < TARGET_COUNT; i++) {
+        at = (at + direction + TARGET_COUNT) % TARGET_COUNT;
+        if (state->hand.targets & (1 << target_pile(at))) {
+            state->selected[0] = at < 4 ? at + 3 : at - 4;
+            state->selected[1] = at < 4 ? 0 : 1;
+            state->selected_card = 1;
+            return true;
+        }
+    }
+    return false;
+}
+
+//Back steps the journal back, a held hand is put down first
+static void undo(GameState *state) {
+    if (state->hand.count) {
+        state->hand.count = 0;
+    } else if (klondike_undo_move(&state->game)) {
+        state->selected_card = 1;
+        check_quick_solve(state);
+    } else {
+        sequencer_cue(state->sequencer, CueFail);
+    }
+}
+
+//also starts the search over when the position changed under it
+static void start_hint(GameState *state) {
+    if (!check_pointer(state->search) || !scheduler_add(&state->scheduler, hint_step, &state->search->hint)) {
+        hint_pending = false;
+        sequencer_cue(state->sequencer, CueFail);
+        return;
+    }
+    hint_start(&state->search->hint, &state->game);
+    hint_pending = true;
+}
+
+//moves the cursor onto the cards of the suggested move and marks where they go
+static void show_hint(GameState *state) {
+    Move move;
+    hint_pending = false;
+    if (!hint_move(&state->search->hint, &move)) {
+        sequencer_cue(state->sequencer, CueFail);
+        return;
+    }
+    state->hand.count = 0;
+    state->selected_card = 1;
+    //draws and recycles are played on the deck, whatever pile the move names
+    if (move.type == MoveDraw || move.type == MoveRecycle) {
+        state->selected[0] = 0;
+        state->selected[1] = 0;
+    } else if (move.from == PileWaste) {
+        state->selected[0] = 1;
+        state->selected[1] = 0;
+    } else if (move.from < PileTableau) {
+        state->selected[0] = move.from - PileFoundation + 3;
+        state->selected[1] = 0;
+    } else {
+        state->selected[0] = move.from - PileTableau;
+        state->selected[1] = 1;
+        if (move.type == MovePile) state->selected_card = move.count;
+    }
+    hint_target = move.type == MovePile ? move.to : PILE_NONE;
+    state->isDirty = true;
+}
+
+static void render_pile(GameState *state, uint8_t pile, DeckType type, int16_t x, int16_t y, int8_t selected,
+                        bool draw_empty) {
+    deck_render(board_pile(&state->game.board, pile), visible_count(state, pile), board_first_exposed(&state->game.board, pile),
+                type, x, y, selected, draw_empty, state->buffer);
 }
 
 void render_play_screen(void *data) {
 
     GameState *state = (GameState *) data;
 
-    check_pointer(state->deck);
-    check_pointer(state->waste);
-
     //Render deck, if there is more than one card left, simulate a bit of depth
-    if (state->deck->count > 1) {
+    if (visible_count(state, PileDeck) > 1) {
         card_render_slot(2, 1, false, state->buffer);
-        deck_render(state->deck, Normal, 1, 0, state->selected[0] == 0 && state->selected[1] == 0, true, state->buffer);
+        render_pile(state, PileDeck, Normal, 1, 0, state->selected[0] == 0 && state->selected[1] == 0, true);
     } else {
-        deck_render(state->deck, Normal, 2, 1, state->selected[0] == 0 && state->selected[1] == 0, true, state->buffer);
+        render_pile(state, PileDeck, Normal, 2, 1, state->selected[0] == 0 && state->selected[1] == 0, true);
     }
 
     //Render waste pile
-    deck_render(state->waste, Normal, 20, 1, state->selected[0] == 1 && state->selected[1] == 0, true, state->buffer);
+    render_pile(state, PileWaste, Normal, 20, 1, state->selected[0] == 1 && state->selected[1] == 0, true);
 
     //Render tableau and foundation
     for (uint8_t x = 0; x < 7; x++) {
         if (x < 4) {
-            check_pointer(state->foundation[x]);
-            deck_render(state->foundation[x], Normal, 56 + x * 18, 1,
-                        state->selected[0] == x + 3 && state->selected[1] == 0, true, state->buffer);
+            render_pile(state, PILE_FOUNDATION(x), Normal, 56 + x * 18, 1,
+                        (state->selected[0] == x + 3 && state->selected[1] == 0) ||
+                        hint_target == PILE_FOUNDATION(x), true);
         }
-        check_pointer(state->tableau[x]);
-        deck_render(state->tableau[x], Vertical, 2 + x * 18, 25,
-                    (state->selected[0] == x && state->selected[1] == 1) ? state->selected_card : 0, true,
-                    state->buffer);
+        int8_t selected = (state->selected[0] == x && state->selected[1] == 1) ? state->selected_card : 0;
+        if (!selected && hint_target == PILE_TABLEAU(x)) selected = 1;
+        render_pile(state, PILE_TABLEAU(x), Vertical, 2 + x * 18, 25, selected, true);
     }
 
-    uint8_t h = state->selected[1] == 1 ? (MIN((uint8_t) state->tableau[state->selected[0]]->count, 4) * 4 + 15) : 0;
+    uint8_t h = state->selected[1] == 1 ? (MIN(visible_count(state, PILE_TABLEAU(state->selected[0])), 4) * 4 + 15) : 0;
 
     //render cards in hand
-    deck_render(state->hand, Vertical, 10 + state->selected[0] * 18, h + 10, false, false,
-                state->buffer);
+    if (state->hand.count)
+        deck_render(board_pile(&state->game.board, state->hand.pile) + state->hand.start, state->hand.count, 0, Vertical,
+                    10 + state->selected[0] * 18, h + 10, false, false, state->buffer);
+
+    //small marks above the foundations and below the columns that take the hand
+    if (state->hand.count) {
+        for (uint8_t i = 0; i < TARGET_COUNT; i++) {
+            if (!(state->hand.targets & (1 << target_pile(i)))) continue;
+            int16_t x = i < 4 ? 62 + i * 18 : 8 + (i - 4) * 18;
+            int16_t y = i < 4 ? 0 : 63;
+            buffer_draw_line(state->buffer, x, y, x + 4, y, Flip);
+        }
+    }
+
+    if (is_flying(state)) {
+        card_render_front(state->animated_card.card, (int16_t) state->animated_card.position.x,
+                          (int16_t) state->animated_card.position.y, false, state->buffer, 22);
+    }
 
     if (started && can_quick_solve) {
         buffer_draw_rbox(state->buffer, 26, 53, 100, 64, White);
@@ -141,8 +307,134 @@ void render_play_screen(void *data) {
 
 }
 
+//moves the cursor by one step, returns true if the selection changed
+static bool move_cursor(GameState *state, InputKey key) {
+    uint8_t before[3] = {state->selected[0], state->selected[1], state->selected_card};
+    switch (key) {
+        case InputKeyLeft:
+            if (state->selected[0] > 0) state->selected[0]--;
+            if (state->selected[0] == 2 && state->selected[1] == 0) state->selected[0]--;
+            state->selected_card = 1;
+            break;
+        case InputKeyRight:
+            if (state->selected[0] < 6) state->selected[0]++;
+            if (state->selected[0] == 2 && state->selected[1] == 0) state->selected[0]++;
+            state->selected_card = 1;
+            break;
+        case InputKeyUp:
+            //try to move selection inside the tableau
+            if (state->selected[1] == 1) {
+                //check if highlight can move up in the tableau
+                uint8_t tableau = PILE_TABLEAU(state->selected[0]);
+                int8_t id = board_first_exposed(&state->game.board, tableau), id_flipped;
+                id_flipped = board_count(&state->game.board, tableau) - id;
+                //move up until it reaches the last exposed card, disable when there is something in hand or no card is exposed
+                if (state->selected_card < id_flipped && id >= 0 && state->hand.count == 0) {
+                    state->selected_card++;
+                }
+                    //move to the top row
+                else {
+                    state->selected[1] = 0;
+                    state->selected_card = 1;
+                    if (state->selected[0] == 2) state->selected[0]--;
+                }
+            }
+            break;
+        case InputKeyDown:
+            if (state->selected[1] == 0) {
+                state->selected_card = 1;
+                state->selected[1] = 1;
+            } else if (state->selected_card > 1) {
+                state->selected_card--;
+            }
+            break;
+        default:
+            break;
+    }
+    return before[0] != state->selected[0] || before[1] != state->selected[1] ||
+           before[2] != state->selected_card;
+}
+
+//apply every navigation step that arrived since the last frame, the result is rendered once
+static void flush_navigation(GameState *state) {
+    bool changed = false;
+    for (uint8_t i = 0; i < pending_count; i++) {
+        changed |= move_cursor(state, pending_nav[i]);
+    }
+    pending_count = 0;
+    if (changed) state->isDirty = true;
+}
+
+static bool is_direction(InputKey key) {
+    return key == InputKeyLeft || key == InputKeyRight || key == InputKeyUp || key == InputKeyDown;
+}
+
+//the end of the row or column in the direction of the key
+static void jump_to_edge(GameState *state, InputKey key) {
+    state->selected_card = 1;
+    switch (key) {
+        case InputKeyLeft:
+            state->selected[0] = 0;
+            break;
+        case InputKeyRight:
+            state->selected[0] = 6;
+            break;
+        case InputKeyUp:
+            state->selected[1] = 0;
+            if (state->selected[0] == 2) state->selected[0]--;
+            break;
+        case InputKeyDown:
+            state->selected[1] = 1;
+            break;
+        default:
+            break;
+    }
+}
+
+//held directions walk the cursor, returns false if the event is not one of them
+static bool hold_direction(GameState *state, InputKey key, InputType type) {
+    if (type == InputTypeLong) {
+        held_key = key;
+        held_walked = false;
+        return true;
+    }
+    if (type == InputTypeRepeat) {
+        if (key == held_key) held_walked = true;
+        //with cards in hand a held Left or Right walks the piles that take them
+        if (state->hand.count && (key == InputKeyLeft || key == InputKeyRight)) {
+            flush_navigation(state);
+            if (jump_to_target(state, key == InputKeyLeft ? -1 : 1)) state->isDirty = true;
+            return true;
+        }
+    }
+    //queue them and let the next update apply the net movement
+    if (type == InputTypePress || type == InputTypeRepeat) {
+        if (pending_count == NAVIGATION_QUEUE) flush_navigation(state);
+        pending_nav[pending_count++] = key;
+        return true;
+    }
+    if (type == InputTypeRelease && key == held_key) {
+        held_key = InputKeyMAX;
+        if (!held_walked) {
+            flush_navigation(state);
+            jump_to_edge(state, key);
+            state->isDirty = true;
+        }
+        return true;
+    }
+    return false;
+}
+
 void update_play_screen(void *data) {
     GameState *state = (GameState *) data;
+    flush_navigation(state);
+    if (autoplay) step_autoplay(state);
+    if (hint_requested) {
+        hint_requested = false;
+        start_hint(state);
+    }
+    if (hint_pending && !hint_matches(&state->search->hint, &state->game)) start_hint(state);
+    if (hint_pending && state->search->hint.ready) show_hint(state);
     if (solved) {
         end_play_screen(state);
     }
@@ -150,113 +442,76 @@ void update_play_screen(void *data) {
 
 void input_play_screen(void *data, InputKey key, InputType type) {
     GameState *state = (GameState *) data;
+    Board *board = &state->game.board;
+
+    if (type == InputTypePress || type == InputTypeShort || type == InputTypeLong) finish_autoplay(state);
+    if (hint_target != PILE_NONE && (type == InputTypePress || type == InputTypeShort)) {
+        hint_target = PILE_NONE;
+        state->isDirty = true;
+    }
+
+    //a long Left or Right with cards in hand and a long Up on the top row have their own actions below
+    bool long_action = false;
+    if (type == InputTypeLong) {
+        flush_navigation(state);
+        long_action = (state->hand.count && (key == InputKeyLeft || key == InputKeyRight)) ||
+                      (key == InputKeyUp && state->selected[1] == 0);
+    }
+    if (is_direction(key) && !long_action && hold_direction(state, key, type)) return;
+
+    //everything else acts on the cursor, so it has to be up-to-date
+    flush_navigation(state);
+    //a long Back exits the game, so undo waits for the release
+    if (key == InputKeyBack && type == InputTypeShort) {
+        undo(state);
+        state->isDirty = true;
+        return;
+    }
+    if (type != InputTypePress && type != InputTypeLong) return;
     state->isDirty = true;
 
     if (type == InputTypePress) {
         switch (key) {
-            case InputKeyLeft:
-                if (state->selected[0] > 0) state->selected[0]--;
-                if (state->selected[0] == 2 && state->selected[1] == 0) state->selected[0]--;
-                state->selected_card = 1;
-                return;
-                break;
-            case InputKeyRight:
-                if (state->selected[0] < 6) state->selected[0]++;
-                if (state->selected[0] == 2 && state->selected[1] == 0) state->selected[0]++;
-                state->selected_card = 1;
-                return;
-                break;
-            case InputKeyUp:
-                //try to move selection inside the tableau
-                if (state->selected[1] == 1) {
-                    //check if highlight can move up in the tableau
-                    int8_t id, id_flipped;
-                    deck_first_non_flipped(state->tableau[state->selected[0]], &id);
-                    id_flipped = state->tableau[state->selected[0]]->count - id;
-                    //move up until it reaches the last exposed card, disable when there is something in hand or no card is exposed
-                    if (state->selected_card < id_flipped && id >= 0 && state->hand->count == 0) {
-                        state->selected_card++;
-                    }
-                        //move to the top row
-                    else {
-                        state->selected[1] = 0;
-                        state->selected_card = 1;
-                        if (state->selected[0] == 2) state->selected[0]--;
-                    }
-                }
-                return;
-                break;
-            case InputKeyDown:
-                if (state->selected[1] == 0) {
-                    state->selected_card = 1;
-                    state->selected[1] = 1;
-                } else if (state->selected_card > 1) {
-                    state->selected_card--;
-                }
-                return;
-                break;
             case InputKeyOk:
 
                 //cycle deck
                 if (state->selected[0] == 0 && state->selected[1] == 0) {
-                    if(state->deck->count > 0 || state->waste->count > 0) {
-                        if (state->deck->count > 0) {
-                            Card *c = list_pop_back(state->deck);
-                            c->exposed = true;
-                            list_push_back(c, state->waste);
-                            return;
-                        } else {
-                            while (state->waste->count) {
-                                Card *c = list_pop_back(state->waste);
-                                c->exposed = false;
-                                list_push_back(c, state->deck);
-                            }
-                            return;
-                        }
-                    }
+                    if (try_move(state, MoveDraw, PileDeck, PileWaste, 1)) return;
+                    //turn the whole waste over in one go
+                    if (try_move(state, MoveRecycle, PileWaste, PileDeck, 0)) return;
                     if(can_quick_solve) return;
                 } else if (state->selected[0] == 1 && state->selected[1] == 0) {
                     //pick from waste
-                    if (state->hand->count == 0 && state->waste->count > 0) {
-                        list_push_back(list_pop_back(state->waste), state->hand);
-                        set_picked_from(1, 0);
+                    if (state->hand.count == 0 && board_count(board, PileWaste) > 0) {
+                        pick(state, PileWaste, 1);
                         return;
-                    } else if (is_picked_from(1, 0)) { //put back to waste
-                        list_push_back(list_pop_back(state->hand), state->waste);
-                        reset_picked();
+                    } else if (is_picked_from(state, PileWaste)) { //put back to waste
+                        state->hand.count = 0;
                         return;
                     }
 
                 }
-                    //test if it can be put to the foundation (only if 1 card is in hand)
-                else if (state->hand->count == 1 && state->selected[1] == 0 && state->selected[0] > 2) {
-                    List *foundation = state->foundation[state->selected[0] - 3];
-                    check_pointer(foundation);
-                    if (card_test_foundation(list_peek_front(state->hand), list_peek_back(foundation))) {
-                        list_push_back(list_pop_front(state->hand), foundation);
-                        reset_picked();
+                    //test if it can be put to the foundation
+                else if (state->hand.count && state->selected[1] == 0 && state->selected[0] > 2) {
+                    if (place_hand(state, PILE_FOUNDATION(state->selected[0] - 3))) {
                         solved = check_finish(state);
                         return;
                     }
                 } else if (state->selected[1] == 1) { //Pick from tableau or flip card
                     //store a reference to the tableau, doesn't matter if we are over them or not, it can be indexed
-                    List *tbl = state->tableau[state->selected[0]];
+                    uint8_t tbl = PILE_TABLEAU(state->selected[0]);
                     //pick cards
-                    if (state->hand->count == 0) {
-                        Card *last = list_peek_back(tbl);
-                        if(last) {
+                    if (state->hand.count == 0) {
+                        Card last = board_peek(board, tbl);
+                        if (last != CARD_NONE) {
                             //Flip card if not exposed
-                            if (!last->exposed) {
-                                last->exposed = true;
+                            if (try_move(state, MoveFlip, tbl, tbl, 0)) {
                                 check_quick_solve(state);
                                 return;
                             }
                                 //Pick cards
                             else {
-                                for (uint8_t i = 0; i < state->selected_card && tbl->count > 0; i++) {
-                                    list_push_front(list_pop_back(tbl), state->hand);
-                                }
-                                set_picked_from(state->selected[0], 1);
+                                pick(state, tbl, state->selected_card);
                                 state->selected_card = 1;
                                 return;
                             }
@@ -265,21 +520,13 @@ void input_play_screen(void *data, InputKey key, InputType type) {
                     }
                         //try to place hand
                     else {
-                        Card *last = list_peek_back(tbl);
                         //place back from where you picked up
-                        if (is_picked_from(state->selected[0], 1)) {
-                            while (state->hand->count) {
-                                list_push_back(list_pop_front(state->hand), tbl);
-                            }
-                            reset_picked();
+                        if (is_picked_from(state, tbl)) {
+                            state->hand.count = 0;
                             return;
                         }
                             //test if the hand can be placed at one of the tableau columns
-                        else if ((!last || last->exposed) && card_test_column(list_peek_front(state->hand), last)) {
-                            while (state->hand->count) {
-                                list_push_back(list_pop_front(state->hand), tbl);
-                            }
-                            reset_picked();
+                        else if (place_hand(state, tbl)) {
                             return;
                         }
                     }
@@ -288,30 +535,19 @@ void input_play_screen(void *data, InputKey key, InputType type) {
             default:
                 return;
         }
-        notification_message(state->notification_app, &sequence_fail);
+        sequencer_cue(state->sequencer, CueFail);
     } else if (type == InputTypeLong) {
         switch (key) {
             case InputKeyLeft:
-                state->selected_card = 1;
-                state->selected[0] = 0;
-                return;
+                //with cards in hand jump between the piles that take them
+                if (jump_to_target(state, -1)) return;
                 break;
             case InputKeyRight:
-                state->selected_card = 1;
-                state->selected[0] = 6;
-                return;
+                if (jump_to_target(state, 1)) return;
                 break;
             case InputKeyUp:
-                state->selected[1] = 0;
-                state->selected_card = 1;
-                if (state->selected[0] == 2) state->selected[0]--;
-                return;
-                break;
-            case InputKeyDown:
-                state->selected_card = 1;
-                state->selected[1] = 1;
+                hint_requested = true;
                 return;
-                break;
             case InputKeyOk:
                 if (can_quick_solve) {
                     end_play_screen(state);
@@ -319,23 +555,28 @@ void input_play_screen(void *data, InputKey key, InputType type) {
                 }
 
                 //try to quick place to the foundation
-                if (state->hand->count == 1) {
-                    Card *c = list_peek_back(state->hand);
+                if (state->hand.count == 1) {
                     for (int8_t i = 0; i < 4; i++) {
-                        if (card_test_foundation(c, list_peek_back(state->foundation[i]))) {
-                            list_push_back(list_pop_back(state->hand), state->foundation[i]);
+                        if (place_hand(state, PILE_FOUNDATION(i))) {
                             state->selected_card = 1;
                             solved = check_finish(state);
                             return;
                         }
                     }
                 }
+
+                //redo the last undone move
+                if (state->hand.count == 0 && klondike_redo_move(&state->game)) {
+                    state->selected_card = 1;
+                    check_quick_solve(state);
+                    return;
+                }
                 break;
             case InputKeyBack:
                 return;
             default:
                 break;
         }
-        notification_message(state->notification_app, &sequence_fail);
+        sequencer_cue(state->sequencer, CueFail);
     }
 }
\ No newline at end of file
@@ -6,6 +6,9 @@
 
 void start_play_screen(void *data);
 
+//cancels the hint job, the search memory stays with the game state
+void exit_play_screen(void *data);
+
 void render_play_screen(void *data);
 
 void update_play_screen(void *data);
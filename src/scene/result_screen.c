@@ -2,23 +2,12 @@
 #include "../../game_state.h"
 #include "../util/helpers.h"
 #include <dolphin/dolphin.h>
-#include <notification/notification_messages.h>
 
 static int hours, minutes, seconds;
 static bool isStarted = false;
 static char timeString[24];
-static const NotificationSequence sequence_cheer = {
-    &message_note_c4,
-    &message_delay_100,
-    &message_note_e4,
-    &message_delay_100,
-    &message_note_g4,
-    &message_delay_100,
-    &message_note_a4,
-    &message_delay_100,
-    &message_sound_off,
-    NULL,
-};
+//empty unless the game was a daily deal
+static char ratingString[24];
 
 void start_result_screen(void *data) {
     GameState *state = (GameState *) data;
@@ -27,32 +16,40 @@ void start_result_screen(void *data) {
     hours = (int) (diff / 3600);
     minutes = (int) (diff % 3600) / 60;
     seconds = (int) (diff % 60);
+    ratingString[0] = '\0';
+    if (state->deal_mode == DealDaily)
+        snprintf(ratingString, sizeof(ratingString), "Daily: %s", rating_name(state->deal_rating));
     state->lateRender = true;
     state->isDirty = true;
     state->clearBuffer = false;
     isStarted = false;
-    notification_message(state->notification_app, (const NotificationSequence *) &sequence_cheer);
+    sequencer_cue(state->sequencer, CueCheer);
 }
 
 void render_result_screen(void *data) {
     GameState *state = (GameState *) data;
 
+    //the rating gets a line below the time
+    bool rated = ratingString[0] != '\0';
+    int32_t y = rated ? 8 : 13;
+
     canvas_set_color(state->canvas, ColorWhite);
-    canvas_draw_box(state->canvas, 22, 14, 85, 30);
+    canvas_draw_box(state->canvas, 22, y + 1, 85, rated ? 40 : 30);
     canvas_set_color(state->canvas, ColorBlack);
-    canvas_draw_frame(state->canvas, 21, 13, 87, 32);
+    canvas_draw_frame(state->canvas, 21, y, 87, rated ? 42 : 32);
 
     canvas_set_font(state->canvas, FontPrimary);
-    canvas_draw_str_aligned(state->canvas, 64, 15, AlignCenter, AlignTop, "Congratulations!");
+    canvas_draw_str_aligned(state->canvas, 64, y + 2, AlignCenter, AlignTop, "Congratulations!");
     canvas_set_font(state->canvas, FontSecondary);
-    canvas_draw_str_aligned(state->canvas, 64, 26, AlignCenter, AlignTop, "Solve time:");
+    canvas_draw_str_aligned(state->canvas, 64, y + 13, AlignCenter, AlignTop, "Solve time:");
 
     if(hours>0)
         snprintf(timeString, sizeof(timeString), "%02d:%02d:%02d", hours, minutes, seconds);
     else
         snprintf(timeString, sizeof(timeString), "%02d:%02d", minutes, seconds);
     canvas_set_font(state->canvas, FontSecondary);
-    canvas_draw_str_aligned(state->canvas, 64, 35, AlignCenter, AlignTop, timeString);
+    canvas_draw_str_aligned(state->canvas, 64, y + 22, AlignCenter, AlignTop, timeString);
+    if (rated) canvas_draw_str_aligned(state->canvas, 64, y + 32, AlignCenter, AlignTop, ratingString);
 }
 
 void update_result_screen(void *data) {
@@ -69,6 +66,6 @@ void update_result_screen(void *data) {
 void input_result_screen(void *data, InputKey key, InputType type) {
     GameState *state = (GameState *) data;
     if (key == InputKeyOk && type == InputTypePress) {
-        state->scene_switch = 1;
+        state->next_scene = SceneMain;
     }
 }
\ No newline at end of file
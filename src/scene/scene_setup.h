@@ -1,7 +1,7 @@
 #pragma once
 
 #include <furi.h>
-#include "../util/list.h"
+#include "../../game_state.h"
 #include "main_screen.h"
 #include "intro_animation.h"
 #include "play_screen.h"
@@ -10,52 +10,82 @@
 #include "falling_card.h"
 
 typedef struct {
-    void (*start)(void *data);
+    const char *name;
+    //called once when the scene becomes active
+    void (*enter)(void *data);
+    //called before the next scene is entered, optional
+    void (*exit)(void *data);
+    //called when the scene becomes the upcoming one, can queue background work for it, optional
+    void (*prepare)(void *data);
     void (*render)(void *data);
 
     void (*update)(void *data);
 
     void (*input)(void *data, InputKey key, InputType type);
+    //scene to warm up while this one is active, its prepare hook is called on enter
+    SceneId preload;
 } GameLogic;
 
-GameLogic main_screen = (GameLogic) {
-    .start=start_main_screen,
-    .render=render_main_screen,
-    .update=update_main_screen,
-    .input= input_main_screen
-};
-
-GameLogic intro_screen = (GameLogic) {
-    .start=start_intro_screen,
-    .render=render_intro_screen,
-    .update=update_intro_screen,
-    .input=input_intro_screen
-};
-
-GameLogic play_screen = (GameLogic) {
-    .start=start_play_screen,
-    .render=render_play_screen,
-    .update=update_play_screen,
-    .input=input_play_screen
-};
-
-GameLogic solve_screen = (GameLogic) {
-    .start=start_solve_screen,
-    .render=render_solve_screen,
-    .update=update_solve_screen,
-    .input=input_solve_screen
-};
-
-GameLogic falling_screen = (GameLogic) {
-    .start=start_falling_screen,
-    .render=render_falling_screen,
-    .update=update_falling_screen,
-    .input=input_falling_screen
-};
-
-GameLogic result_screen = (GameLogic) {
-    .start=start_result_screen,
-    .render=render_result_screen,
-    .update=update_result_screen,
-    .input=input_result_screen
+static const GameLogic scenes[SceneCount] = {
+    [SceneMain]=(GameLogic) {
+        .name="main",
+        .enter=start_main_screen,
+        .exit=end_main_screen,
+        .prepare=NULL,
+        .render=render_main_screen,
+        .update=update_main_screen,
+        .input=input_main_screen,
+        .preload=SceneIntro
+    },
+    [SceneIntro]=(GameLogic) {
+        .name="intro",
+        .enter=start_intro_screen,
+        .exit=end_intro_screen,
+        .prepare=prepare_intro_screen,
+        .render=render_intro_screen,
+        .update=update_intro_screen,
+        .input=input_intro_screen,
+        .preload=SceneNone
+    },
+    [ScenePlay]=(GameLogic) {
+        .name="play",
+        .enter=start_play_screen,
+        .exit=exit_play_screen,
+        .prepare=NULL,
+        .render=render_play_screen,
+        .update=update_play_screen,
+        .input=input_play_screen,
+        .preload=SceneNone
+    },
+    [SceneSolve]=(GameLogic) {
+        .name="solve",
+        .enter=start_solve_screen,
+        .exit=NULL,
+        .prepare=NULL,
+        .render=render_solve_screen,
+        .update=update_solve_screen,
+        .input=input_solve_screen,
+        .preload=SceneNone
+    },
+    [SceneFalling]=(GameLogic) {
+        .name="falling",
+        .enter=start_falling_screen,
+        .exit=end_falling_screen,
+        .prepare=NULL,
+        .render=render_falling_screen,
+        .update=update_falling_screen,
+        .input=input_falling_screen,
+        .preload=SceneNone
+    },
+    [SceneResult]=(GameLogic) {
+        .name="result",
+        .enter=start_result_screen,
+        .exit=NULL,
+        .prepare=NULL,
+        .render=render_result_screen,
+        .update=update_result_screen,
+        .input=input_result_screen,
+        //the menu has nothing to load, get the next game ready instead
+        .preload=SceneIntro
+    },
 };
@@ -18,7 +18,7 @@ void render_solve_screen(void *data) {
 
     render_play_screen(state);
 
-    if (state->animated_card.card) {
+    if (state->animated_card.card != CARD_NONE) {
         card_render_front(
             state->animated_card.card,
             (uint8_t) state->animated_card.position.x,
@@ -31,24 +31,16 @@ void render_solve_screen(void *data) {
 }
 
 bool end_solve_screen(GameState *state) {
-    for (uint8_t i = 0; i < 4; i++) {
-        Card *c = list_peek_back(state->foundation[i]);
-        if (!c || c->value != KING) return false;
-    }
-
-    return true;
+    return board_on_foundation(&state->game.board) == CARD_COUNT;
 }
 
 static int8_t missing_suit(GameState *state) {
-    bool found[4] = {false, false, false, false};
-    for (uint8_t i = 0; i < 4; i++) {
-        if (state->foundation[i]->count) {
-            Card *c = list_peek_back(state->foundation[i]);
-            found[c->suit] = true;
-        }
-    }
+    //a suit is started once its ace sits on a foundation
     for (int8_t i = 0; i < 4; i++) {
-        if (!found[i]) return i;
+        uint8_t pile, index;
+        if (!board_locate(&state->game.board, card_make(i, ACE), &pile, &index) ||
+            pile < PileFoundation || pile >= PileTableau)
+            return i;
     }
 
     return -1;
@@ -56,33 +48,26 @@ static int8_t missing_suit(GameState *state) {
 
 static void quick_solve(GameState *state) {
     //remove all cards that are not placed to the foundation yet
-    list_free_data(state->deck);
-    list_free_data(state->waste);
+    board_clear_pile(&state->game.board, PileDeck);
+    board_clear_pile(&state->game.board, PileWaste);
     for (uint8_t i = 0; i < 7; i++) {
-        list_free_data(state->tableau[i]);
+        board_clear_pile(&state->game.board, PILE_TABLEAU(i));
     }
-    list_free_data(state->hand);
 
-    state->animated_card.card = NULL;
+    state->animated_card.card = CARD_NONE;
 
     //fill up the foundations with cards
     for (uint8_t i = 0; i < 4; i++) {
+        uint8_t foundation = PILE_FOUNDATION(i);
         //add ace to the start
-        if (state->foundation[i]->count == 0) {
-            Card *c = malloc(sizeof(Card));
-            c->value = ACE;
-            c->suit = missing_suit(state);
-            c->exposed = true;
-            list_push_back(c, state->foundation[i]);
+        if (board_count(&state->game.board, foundation) == 0) {
+            board_push(&state->game.board, foundation, card_make(missing_suit(state), ACE) | CARD_EXPOSED);
         }
 
         //fill up the rest
-        for (uint8_t v = state->foundation[i]->count; v < 13; v++) {
-            Card *c = malloc(sizeof(Card));
-            c->value = v - 1;
-            c->suit = ((Card *) list_peek_back(state->foundation[i]))->suit;
-            c->exposed = true;
-            list_push_back(c, state->foundation[i]);
+        uint8_t suit = card_suit(board_peek(&state->game.board, foundation));
+        for (uint8_t v = board_count(&state->game.board, foundation); v < 13; v++) {
+            board_push(&state->game.board, foundation, card_make(suit, v - 1) | CARD_EXPOSED);
         }
     }
 
@@ -90,9 +75,10 @@ static void quick_solve(GameState *state) {
 }
 
 static bool animation_done(GameState *state) {
-    if (!state->animated_card.card) return true;
+    if (state->animated_card.card == CARD_NONE) return true;
 
-    accumulated_delta += state->delta_time * 4;
+    //fewer intermediate frames when the device can't keep up
+    accumulated_delta += state->delta_time * (state->watchdog.quality == QualityMinimal ? 8 : 4);
     vector_lerp(&(animation_from), &animation_target, accumulated_delta,
                 &(state->animated_card.position));
 
@@ -100,79 +86,51 @@ static bool animation_done(GameState *state) {
     return dist < 1;
 }
 
-static Card *find_and_remove(List *list, uint8_t suit, uint8_t value) {
-    //go reversed order because tableau will always have at the end
-    ListItem *current = list->tail;
-    while (current) {
-        if (((Card *) current->data)->value == value && ((Card *) current->data)->suit == suit) {
-            Card *c = current->data;
-            list_remove_item(c, list);
-            return c;
-        }
-        current = current->prev;
+//takes the card off the board and starts animating it towards the target foundation
+static void animate_card(GameState *state, uint8_t suit, uint8_t value) {
+    uint8_t pile, index;
+    //once the last card landed every foundation top points at a card that is already in place
+    if (!board_locate(&state->game.board, card_make(suit, value), &pile, &index)) return;
+    if (pile >= PileFoundation && pile < PileTableau) return;
+
+    float column_height = (float) MIN(board_count(&state->game.board, PILE_TABLEAU(state->selected[0])), 4) * 4 + 15;
+    state->animated_card.card = board_remove_at(&state->game.board, pile, index) | CARD_EXPOSED;
+    if (pile < PileTableau) {
+        animation_from.x = pile == PileWaste ? 20 : 2;
+        animation_from.y = 1;
+    } else {
+        animation_from.x = 2 + (pile - PileTableau) * 18;
+        animation_from.y = column_height;
     }
+    state->animated_card.position = animation_from;
 
-    return NULL;
+    animation_target.x = (float) (56 + target_foundation * 18);
+    animation_target.y = 1;
 }
 
-static uint8_t positions[9] = {
-    2, 20,
-    2, 20, 38, 56, 74, 92, 110
-};
-
 static void find_next_card(GameState *state) {
-    List *order[9] = {state->deck, state->waste, state->tableau[0], state->tableau[1], state->tableau[2],
-                      state->tableau[3], state->tableau[4], state->tableau[5], state->tableau[6]};
-
     int8_t missing = missing_suit(state);
     if (missing >= 0) {
-        //find the missing ACE
-        for (uint8_t id = 0; id < 9; id++) {
-            Card *ace = find_and_remove(order[id], missing, ACE);
-            if (ace) {
-                ace->exposed = true;
-                for (uint8_t i = 0; i < 4; i++) {
-                    if (state->foundation[i]->count == 0) {
-                        state->animated_card.card = ace;
-                        target_foundation = i;
-                        animation_from.x = positions[id];
-                        animation_from.y =
-                            id < 2 ? 1 : ((float) MIN((uint8_t) state->tableau[state->selected[0]]->count, 4) * 4 + 15);
-                        state->animated_card.position = animation_from;
-
-                        animation_target.x = (float) (56 + target_foundation * 18);
-                        animation_target.y = 1;
-                    }
-                }
+        //the missing ACE goes to the last empty foundation
+        for (int8_t i = 3; i >= 0; i--) {
+            if (board_count(&state->game.board, PILE_FOUNDATION(i)) == 0) {
+                target_foundation = i;
+                animate_card(state, missing, ACE);
+                break;
             }
         }
     } else {
         uint8_t lowestValue = 14, lowestSuit = 0;
         //get the lowest value
         for (uint8_t i = 0; i < 4; i++) {
-            Card *c = list_peek_back(state->foundation[i]);
-            if (lowestValue > ((c->value + 1) % 13)) {
-                lowestValue = ((c->value + 1) % 13);
+            Card c = board_peek(&state->game.board, PILE_FOUNDATION(i));
+            if (lowestValue > ((card_value(c) + 1) % 13)) {
+                lowestValue = ((card_value(c) + 1) % 13);
                 target_foundation = i;
-                lowestSuit = c->suit;
-            }
-        }
-        //store that card to animate
-        for (uint8_t id = 0; id < 9; id++) {
-            Card *c = find_and_remove(order[id], lowestSuit, lowestValue);
-            if (c) {
-                state->animated_card.card = c;
-
-                animation_from.x = positions[id];
-                animation_from.y =
-                    id < 2 ? 1 : ((float) MIN((uint8_t) state->tableau[state->selected[0]]->count, 4) * 4 + 15);
-                state->animated_card.position = animation_from;
-
-                animation_target.x = (float) (56 + target_foundation * 18);
-                animation_target.y = 1;
-                break;
+                lowestSuit = card_suit(c);
             }
         }
+        animate_card(state, lowestSuit, lowestValue);
     }
 }
 
@@ -183,16 +141,15 @@ void update_solve_screen(void *data) {
 
     if (!end_solve_screen(state)) {
         if (animation_done(state)) {
-            if (state->animated_card.card) {
-                state->animated_card.card->exposed=true;
-                list_push_back(state->animated_card.card, state->foundation[target_foundation]);
-                state->animated_card.card = NULL;
+            if (state->animated_card.card != CARD_NONE) {
+                board_push(&state->game.board, PILE_FOUNDATION(target_foundation), state->animated_card.card | CARD_EXPOSED);
+                state->animated_card.card = CARD_NONE;
                 accumulated_delta=0;
             }
             find_next_card(state);
         }
     } else {
-        state->scene_switch = 1;
+        state->next_scene = SceneFalling;
     }
 }
 
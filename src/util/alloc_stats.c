@@ -0,0 +1,79 @@
+#include "helpers.h"
+#include <stddef.h>
+#include <inttypes.h>
+
+#ifdef ALLOC_STATS
+
+#undef malloc
+#undef free
+
+//keeps the block size in front of the data so free knows how much was released
+typedef union {
+    size_t size;
+    max_align_t align;
+} AllocHeader;
+
+typedef struct {
+    uint32_t allocs;
+    uint32_t frees;
+    uint32_t bytes;
+    uint32_t frames;
+    uint32_t worst_frame;
+    size_t in_use;
+    size_t peak;
+    size_t min_free_heap;
+} SceneStats;
+
+static SceneStats scene_stats = {0, 0, 0, 0, 0, 0, 0, SIZE_MAX};
+static uint32_t frame_allocs = 0;
+static size_t frame_bytes = 0;
+static size_t in_use = 0;
+
+void *alloc_stats_malloc(size_t size) {
+    AllocHeader *header = malloc(sizeof(AllocHeader) + size);
+    header->size = size;
+    in_use += size;
+    frame_allocs++;
+    frame_bytes += size;
+    scene_stats.allocs++;
+    scene_stats.bytes += size;
+    scene_stats.peak = MAX(scene_stats.peak, in_use);
+    return header + 1;
+}
+
+void alloc_stats_free(void *ptr) {
+    if (ptr == NULL) return;
+    AllocHeader *header = ((AllocHeader *) ptr) - 1;
+    in_use -= header->size;
+    scene_stats.frees++;
+    free(header);
+}
+
+void alloc_stats_frame_end(const char *scene) {
+    if (frame_allocs) {
+        FURI_LOG_W("ALLOC", "%s frame allocated %" PRIu32 " times, %zu bytes", scene, frame_allocs, frame_bytes);
+    }
+    scene_stats.worst_frame = MAX(scene_stats.worst_frame, frame_allocs);
+    scene_stats.min_free_heap = MIN(scene_stats.min_free_heap, memmgr_get_free_heap());
+    scene_stats.frames++;
+    frame_allocs = 0;
+    frame_bytes = 0;
+}
+
+void alloc_stats_scene_end(const char *scene) {
+    scene_stats.min_free_heap = MIN(scene_stats.min_free_heap, memmgr_get_free_heap());
+    FURI_LOG_I("ALLOC",
+               "%s: %" PRIu32 " frames, %" PRIu32 " allocs %" PRIu32 " frees %" PRIu32 " bytes, worst frame %" PRIu32
+               " allocs, app heap %zu now %zu peak, free heap low %zu, stack free %" PRIu32,
+               scene, scene_stats.frames, scene_stats.allocs, scene_stats.frees, scene_stats.bytes,
+               scene_stats.worst_frame, in_use, scene_stats.peak, scene_stats.min_free_heap,
+               furi_thread_get_stack_space(furi_thread_get_current_id()));
+    //allocations made by the transition itself are already part of the totals above
+    frame_allocs = 0;
+    frame_bytes = 0;
+    memset(&scene_stats, 0, sizeof(SceneStats));
+    scene_stats.peak = in_use;
+    scene_stats.min_free_heap = SIZE_MAX;
+}
+
+#endif
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <furi.h>
+
+//Heap and stack instrumentation, enable ALLOC_STATS in helpers.h
+//malloc and free of the app are routed through counters, every frame that touches the heap is reported and
+//each scene logs its totals, peak heap use and the stack high-water mark when it is left
+
+#ifdef ALLOC_STATS
+
+void *alloc_stats_malloc(size_t size);
+
+void alloc_stats_free(void *ptr);
+
+void alloc_stats_frame_end(const char *scene);
+
+void alloc_stats_scene_end(const char *scene);
+
+#define malloc(size) alloc_stats_malloc(size)
+#define free(ptr) alloc_stats_free(ptr)
+#define alloc_stats_frame(scene) alloc_stats_frame_end(scene)
+#define alloc_stats_scene(scene) alloc_stats_scene_end(scene)
+
+#else
+
+#define alloc_stats_frame(scene) do {} while (0)
+#define alloc_stats_scene(scene) do {} while (0)
+
+#endif
@@ -0,0 +1,198 @@
+#include "board.h"
+#include <string.h>
+
+static uint8_t pile_start(const Board *board, uint8_t pile) {
+    return pile == 0 ? 0 : board->end[pile - 1];
+}
+
+static uint8_t total(const Board *board) {
+    return board->end[PileCount - 1];
+}
+
+//refreshes the location of the cards of a pile from index onwards
+static void reindex(Board *board, uint8_t pile, uint8_t index) {
+    uint8_t start = pile_start(board, pile);
+    for (uint8_t i = start + index; i < board->end[pile]; i++) {
+        uint8_t id = card_id(board->cards[i]);
+        board->pile_of[id] = pile;
+        board->index_of[id] = i - start;
+    }
+}
+
+//counts the face down cards of a run and collects it into a card set
+static uint8_t count_hidden(const Card *cards, uint8_t count, uint64_t *set) {
+    uint8_t hidden = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        if (!card_is_exposed(cards[i])) hidden++;
+        *set |= card_bit(cards[i]);
+    }
+    return hidden;
+}
+
+void board_clear(Board *board) {
+    memset(board->end, 0, sizeof(board->end));
+    memset(board->hidden, 0, sizeof(board->hidden));
+    memset(board->pile_of, PILE_NONE, sizeof(board->pile_of));
+    memset(board->pile_set, 0, sizeof(board->pile_set));
+    board->hidden_total = 0;
+    board->exposed = 0;
+}
+
+void board_clear_pile(Board *board, uint8_t pile) {
+    uint8_t start = pile_start(board, pile);
+    uint8_t count = board->end[pile] - start;
+    if (!count) return;
+    for (uint8_t i = start; i < start + count; i++) board->pile_of[card_id(board->cards[i])] = PILE_NONE;
+    board->hidden_total -= board->hidden[pile];
+    board->hidden[pile] = 0;
+    board->exposed &= ~board->pile_set[pile];
+    board->pile_set[pile] = 0;
+    memmove(&(board->cards[start]), &(board->cards[start + count]), total(board) - start - count);
+    for (uint8_t p = pile; p < PileCount; p++) board->end[p] -= count;
+}
+
+uint8_t board_count(const Board *board, uint8_t pile) {
+    return board->end[pile] - pile_start(board, pile);
+}
+
+uint8_t board_hidden(const Board *board, uint8_t pile) {
+    return board->hidden[pile];
+}
+
+int8_t board_first_exposed(const Board *board, uint8_t pile) {
+    return board->hidden[pile] < board_count(board, pile) ? (int8_t) board->hidden[pile] : -1;
+}
+
+uint8_t board_on_foundation(const Board *board) {
+    return board->end[PileTableau - 1] - board->end[PileFoundation - 1];
+}
+
+Card *board_pile(Board *board, uint8_t pile) {
+    return &(board->cards[pile_start(board, pile)]);
+}
+
+Card board_peek(const Board *board, uint8_t pile) {
+    if (board->end[pile] == pile_start(board, pile)) return CARD_NONE;
+    return board->cards[board->end[pile] - 1];
+}
+
+Card board_peek_index(const Board *board, uint8_t pile, uint8_t index) {
+    if (index >= board_count(board, pile)) return CARD_NONE;
+    return board->cards[pile_start(board, pile) + index];
+}
+
+void board_push(Board *board, uint8_t pile, Card card) {
+    uint8_t at = board->end[pile];
+    if (total(board) >= CARD_COUNT) return;
+    memmove(&(board->cards[at + 1]), &(board->cards[at]), total(board) - at);
+    board->cards[at] = card;
+    for (uint8_t p = pile; p < PileCount; p++) board->end[p]++;
+    board->pile_of[card_id(card)] = pile;
+    board->index_of[card_id(card)] = board_count(board, pile) - 1;
+    board->pile_set[pile] |= card_bit(card);
+    if (card_is_exposed(card)) {
+        board->exposed |= card_bit(card);
+    } else {
+        board->hidden[pile]++;
+        board->hidden_total++;
+    }
+}
+
+Card board_remove_at(Board *board, uint8_t pile, uint8_t index) {
+    if (index >= board_count(board, pile)) return CARD_NONE;
+    uint8_t at = pile_start(board, pile) + index;
+    Card card = board->cards[at];
+    memmove(&(board->cards[at]), &(board->cards[at + 1]), total(board) - at - 1);
+    for (uint8_t p = pile; p < PileCount; p++) board->end[p]--;
+    board->pile_of[card_id(card)] = PILE_NONE;
+    board->pile_set[pile] &= ~card_bit(card);
+    board->exposed &= ~card_bit(card);
+    if (!card_is_exposed(card)) {
+        board->hidden[pile]--;
+        board->hidden_total--;
+    }
+    reindex(board, pile, index);
+    return card;
+}
+
+Card board_pop(Board *board, uint8_t pile) {
+    uint8_t count = board_count(board, pile);
+    if (!count) return CARD_NONE;
+    return board_remove_at(board, pile, count - 1);
+}
+
+void board_set_exposed(Board *board, uint8_t pile, uint8_t index, bool exposed) {
+    if (index >= board_count(board, pile)) return;
+    Card *card = &(board->cards[pile_start(board, pile) + index]);
+    if (card_is_exposed(*card) == exposed) return;
+    board->exposed ^= card_bit(*card);
+    if (exposed) {
+        *card |= CARD_EXPOSED;
+        board->hidden[pile]--;
+        board->hidden_total--;
+    } else {
+        *card &= ~CARD_EXPOSED;
+        board->hidden[pile]++;
+        board->hidden_total++;
+    }
+}
+
+static void reverse_range(Card *cards, uint8_t count) {
+    if (count < 2) return;
+    Card *low = cards;
+    Card *high = cards + count - 1;
+    while (low < high) {
+        Card c = *low;
+        *low++ = *high;
+        *high-- = c;
+    }
+}
+
+void board_reverse(Board *board, uint8_t pile, uint8_t count) {
+    uint8_t available = board_count(board, pile);
+    if (count > available) count = available;
+    if (count < 2) return;
+
+    reverse_range(&(board->cards[board->end[pile] - count]), count);
+    reindex(board, pile, available - count);
+}
+
+bool board_locate(const Board *board, Card card, uint8_t *pile, uint8_t *index) {
+    uint8_t id = card_id(card);
+    if (board->pile_of[id] == PILE_NONE) return false;
+    *pile = board->pile_of[id];
+    *index = board->index_of[id];
+    return true;
+}
+
+void board_move(Board *board, uint8_t from, uint8_t to, uint8_t count) {
+    uint8_t available = board_count(board, from);
+    if (count > available) count = available;
+    if (!count || from == to) return;
+
+    uint8_t run_start = board->end[from] - count;
+    uint64_t run = 0;
+    uint8_t hidden = count_hidden(&(board->cards[run_start]), count, &run);
+    board->hidden[from] -= hidden;
+    board->hidden[to] += hidden;
+    board->pile_set[from] &= ~run;
+    board->pile_set[to] |= run;
+
+    //the run and the piles in between swap places, rotated in place by three reversals so no copy of the run is
+    //kept on the stack
+    if (from < to) {
+        uint8_t gap_end = board->end[to];
+        reverse_range(&(board->cards[run_start]), count);
+        reverse_range(&(board->cards[run_start + count]), gap_end - run_start - count);
+        reverse_range(&(board->cards[run_start]), gap_end - run_start);
+        for (uint8_t p = from; p < to; p++) board->end[p] -= count;
+    } else {
+        uint8_t gap_start = board->end[to];
+        reverse_range(&(board->cards[gap_start]), run_start - gap_start);
+        reverse_range(&(board->cards[run_start]), count);
+        reverse_range(&(board->cards[gap_start]), run_start + count - gap_start);
+        for (uint8_t p = to; p < from; p++) board->end[p] += count;
+    }
+    //only the moved run changes place, the other piles keep their indices
+    reindex(board, to, board_count(board, to) - count);
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//One byte per card: bits 0-5 are the card id (suit * 13 + value), bit 6 tells if it is face up
+typedef uint8_t Card;
+
+#define CARD_COUNT 52
+#define CARD_ID_MASK 0x3F
+#define CARD_EXPOSED 0x40
+#define CARD_NONE 0xFF
+
+typedef enum {
+    TWO = 0,        //1
+    THREE = 1,      //2
+    FOUR = 2,       //3
+    FIVE = 3,       //4
+    SIX = 4,        //5
+    SEVEN = 5,      //6
+    EIGHT = 6,      //7
+    NINE = 7,       //8
+    TEN = 8,        //9
+    JACK = 9,       //10
+    QUEEN = 10,     //11
+    KING = 11,      //12
+    ACE = 12,       //13
+} CardValue;
+
+#define card_make(suit, value) ((Card) ((suit) * 13 + (value)))
+#define card_id(c) ((c) & CARD_ID_MASK)
+#define card_suit(c) (card_id(c) / 13)
+#define card_value(c) (card_id(c) % 13)
+#define card_is_exposed(c) (((c) & CARD_EXPOSED) != 0)
+#define card_bit(c) (1ULL << card_id(c))
+
+typedef enum {
+    PileDeck,
+    PileWaste,
+    PileFoundation,
+    PileTableau = PileFoundation + 4,
+    PileCount = PileTableau + 7,
+} PileId;
+
+#define PILE_FOUNDATION(i) (PileFoundation + (i))
+#define PILE_TABLEAU(i) (PileTableau + (i))
+
+//Every card of the game in one array, each pile is a contiguous run of it ending at end[pile]
+//pile_of and index_of map a card id to where it is, PILE_NONE when it is not on the board
+//hidden counts the face down cards of each pile, kept up to date by every mutation
+//pile_set and exposed are the same information as card sets, bit n stands for card id n
+typedef struct {
+    Card cards[CARD_COUNT];
+    uint8_t end[PileCount];
+    uint8_t pile_of[CARD_COUNT];
+    uint8_t index_of[CARD_COUNT];
+    uint8_t hidden[PileCount];
+    uint8_t hidden_total;
+    uint64_t pile_set[PileCount];
+    uint64_t exposed;
+} Board;
+
+#define PILE_NONE 0xFF
+
+void board_clear(Board *board);
+
+//removes every card of a single pile
+void board_clear_pile(Board *board, uint8_t pile);
+
+uint8_t board_count(const Board *board, uint8_t pile);
+
+uint8_t board_hidden(const Board *board, uint8_t pile);
+
+//face down cards always sit at the bottom of a pile, so this is the hidden count, -1 if every card is hidden
+int8_t board_first_exposed(const Board *board, uint8_t pile);
+
+//cards on the four foundations, they are neighbouring piles so this is a single subtraction
+uint8_t board_on_foundation(const Board *board);
+
+//bottom card of the pile, cards are indexed from the bottom up to count-1 at the top
+Card *board_pile(Board *board, uint8_t pile);
+
+Card board_peek(const Board *board, uint8_t pile);
+
+Card board_peek_index(const Board *board, uint8_t pile, uint8_t index);
+
+void board_push(Board *board, uint8_t pile, Card card);
+
+Card board_pop(Board *board, uint8_t pile);
+
+Card board_remove_at(Board *board, uint8_t pile, uint8_t index);
+
+void board_set_exposed(Board *board, uint8_t pile, uint8_t index, bool exposed);
+
+//finds a card by id, returns false if it is not on the board
+bool board_locate(const Board *board, Card card, uint8_t *pile, uint8_t *index);
+
+//reverses the order of the top count cards of a pile in place
+void board_reverse(Board *board, uint8_t pile, uint8_t count);
+
+//moves the top count cards from one pile to the top of another, keeping their order
+void board_move(Board *board, uint8_t from, uint8_t to, uint8_t count);
@@ -28,25 +28,30 @@ static Buffer *suits[] = {
 };
 
 static Buffer *backSide = (Buffer *) &sprite_pattern_big;
+static bool rotated_corners = true;
 
-void card_render_front(Card *c, int16_t x, int16_t y, bool selected, Buffer *buffer, uint8_t size_limit) {
+void card_set_quality(RenderQuality quality) {
+    rotated_corners = quality == QualityFull;
+}
+
+void card_render_front(Card c, int16_t x, int16_t y, bool selected, Buffer *buffer, uint8_t size_limit) {
     uint8_t height = y + fmin(size_limit, 22);
 
     buffer_draw_rbox(buffer, x, y, x + 16, height, White);
     buffer_draw_rbox_frame(buffer, x, y, x + 16, height, Black);
 
     Vector p = (Vector) {(float) x + 6, (float) y + 5};
-    buffer_draw_all(buffer, letters[c->value], &p, 0);
+    buffer_draw_all(buffer, letters[card_value(c)], &p, 0);
 
     p = (Vector) {(float) x + 12, (float) y + 5};
-    buffer_draw_all(buffer, suits[c->suit], &p, 0);
+    buffer_draw_all(buffer, suits[card_suit(c)], &p, 0);
 
 
-    if (size_limit > 8) {
+    if (size_limit > 8 && rotated_corners) {
         p = (Vector) {(float) x + 10, (float) y + 16};
-        buffer_draw_all(buffer, letters[c->value], &p, M_PI);
+        buffer_draw_all(buffer, letters[card_value(c)], &p, M_PI);
         p = (Vector) {(float) x + 4, (float) y + 16};
-        buffer_draw_all(buffer, suits[c->suit], &p, M_PI);
+        buffer_draw_all(buffer, suits[card_suit(c)], &p, M_PI);
     }
     if (selected) {
         buffer_draw_box(buffer, x , y , x + 17, height+1, Flip);
@@ -77,9 +82,9 @@ void card_render_back(int16_t x, int16_t y, bool selected, Buffer *buffer, uint8
     }
 }
 
-void card_try_render(Card *c, int16_t x, int16_t y, bool selected, Buffer *buffer, uint8_t size_limit) {
-    if (c) {
-        if (c->exposed)
+void card_try_render(Card c, int16_t x, int16_t y, bool selected, Buffer *buffer, uint8_t size_limit) {
+    if (c != CARD_NONE) {
+        if (card_is_exposed(c))
             card_render_front(c, x, y, selected, buffer, size_limit);
         else
             card_render_back(x, y, selected, buffer, size_limit);
@@ -88,64 +93,45 @@ void card_try_render(Card *c, int16_t x, int16_t y, bool selected, Buffer *buffe
     }
 }
 
-bool card_test_foundation(Card *data, Card *target) {
-    if (!target || (target->value == -1 && target->suit == data->suit)) {
-        return data->value == ACE;
-    }
-    return target->suit == data->suit && ((target->value + 1) % 13 == data->value % 13);
+void deck_shuffle_start(DeckShuffle *shuffle, uint32_t seed) {
+    for (uint8_t i = 0; i < DECK_SIZE; i++) shuffle->cards[i] = i;
+    shuffle->position = 0;
+    shuffle->ready = false;
+    shuffle->rng = seed;
 }
 
-bool card_test_column(Card *data, Card *target) {
-    if (!target) return data->value == KING;
-    return target->suit % 2 == (data->suit + 1) % 2 && (data->value + 1) == target->value;
+bool deck_shuffle_step(void *ctx) {
+    DeckShuffle *shuffle = (DeckShuffle *) ctx;
+    uint8_t end = MIN(shuffle->position + DECK_SHUFFLE_STEP, DECK_SIZE);
+    klondike_shuffle(shuffle->cards, shuffle->position, end, &shuffle->rng);
+    shuffle->position = end;
+    shuffle->ready = shuffle->position == DECK_SIZE;
+    return shuffle->ready;
 }
 
-List *deck_generate(uint8_t deck_count) {
-    List *deck = list_make();
-    int cards_count = 52 * deck_count;
-    uint8_t cards[cards_count];
-    for (int i = 0; i < cards_count; i++) cards[i] = i % 52;
-    srand(curr_time());
-
-    //reorder
-    for (int i = 0; i < cards_count; i++) {
-        int r = i + (rand() % (cards_count - i));
-        uint8_t card = cards[i];
-        cards[i] = cards[r];
-        cards[r] = card;
-    }
+void deck_from_shuffle(DeckShuffle *shuffle, Klondike *game) {
+    while (!deck_shuffle_step(shuffle));
 
-    //Init deck list
-    for (int i = 0; i < cards_count; i++) {
-        Card *c = malloc(sizeof(Card));
-        c->value = cards[i] % 13;
-        c->suit = cards[i] / 13;
-        c->exposed = false;
-        list_push_back(c, deck);
-    }
-
-    return deck;
+    klondike_setup(game, shuffle->cards);
+    shuffle->position = 0;
+    shuffle->ready = false;
 }
 
-void deck_free(List *deck) {
-    list_free(deck);
-}
+void deck_render_vertical(const Card *deck, uint8_t count, int8_t first_exposed, uint8_t x, uint8_t y, int8_t selected,
+                          Buffer *buffer) {
 
-void deck_render_vertical(List *deck, uint8_t x, uint8_t y, int8_t selected, Buffer *buffer) {
-
-    check_pointer(deck);
     check_pointer(buffer);
-    uint8_t loop_end = deck->count;
+    uint8_t loop_end = count;
     int8_t selection = loop_end - selected;
     uint8_t loop_start = MAX(loop_end - 4, 0);
     uint8_t position = 0;
-    int8_t first_non_flipped;
-    Card *first_non_flipped_card = deck_first_non_flipped(deck, &first_non_flipped);
+    int8_t first_non_flipped = first_exposed < count ? first_exposed : -1;
+    Card first_non_flipped_card = first_non_flipped >= 0 ? deck[first_non_flipped] : CARD_NONE;
 
     bool had_top = false;
     bool showDark = selection >= 0;
 
-    if (first_non_flipped <= loop_start && selection != first_non_flipped && first_non_flipped_card) {
+    if (first_non_flipped <= loop_start && selection != first_non_flipped && first_non_flipped_card != CARD_NONE) {
         // Draw a card back if it is not the first card
         if (first_non_flipped > 0) {
             card_render_back(x, y + position, false, buffer, 5);
@@ -156,7 +142,7 @@ void deck_render_vertical(List *deck, uint8_t x, uint8_t y, int8_t selected, Buf
         }
 
         // Draw the front side of the first non-flipped card
-        card_try_render(first_non_flipped_card, x, y + position, false, buffer, deck->count == 1 ? 22 : 9);
+        card_try_render(first_non_flipped_card, x, y + position, false, buffer, count == 1 ? 22 : 9);
 
         position += 8;
         loop_start++; // Increment loop start index
@@ -170,42 +156,32 @@ void deck_render_vertical(List *deck, uint8_t x, uint8_t y, int8_t selected, Buf
             loop_start++;
         }
 
-        Card *selected_card = (Card *) list_peek_index(deck, selection);
-        check_pointer(selected_card);
         // Draw the front side of the selected card
-        card_try_render(selected_card, x, y + position, showDark, buffer, 9);
+        card_try_render(selection >= 0 ? deck[selection] : CARD_NONE, x, y + position, showDark, buffer, 9);
         position += 8;
         loop_start++; // Increment loop start index
     }
 
     int height = 5;
-    ListItem *curr = list_get_index(deck, loop_start);
     for (uint8_t i = loop_start; i < loop_end; i++) {
-        check_pointer(curr);
-        if (!curr) break;
-
-        if (i >= loop_start && i < loop_end) {
-            height = 5;
-            if ((i + 1) == loop_end) height = 22;
-            else if (i == selection || i == first_non_flipped) height = 9;
-            Card *c = (Card *) curr->data;
-            check_pointer(c);
-            card_try_render(c, x, y + position, i == selection && showDark, buffer, height);
-            if (i == selection || i == first_non_flipped)position += 4;
-            position += 4;
-        }
-        curr = curr->next;
+        height = 5;
+        if ((i + 1) == loop_end) height = 22;
+        else if (i == selection || i == first_non_flipped) height = 9;
+        card_try_render(deck[i], x, y + position, i == selection && showDark, buffer, height);
+        if (i == selection || i == first_non_flipped)position += 4;
+        position += 4;
     }
 }
 
-void deck_render(List *deck, DeckType type, int16_t x, int16_t y, int8_t selected, bool draw_empty, Buffer *buffer) {
+void deck_render(const Card *deck, uint8_t count, int8_t first_exposed, DeckType type, int16_t x, int16_t y,
+                 int8_t selected, bool draw_empty, Buffer *buffer) {
     switch (type) {
         case Normal:
-            card_try_render(list_peek_back(deck), x, y, selected == 1, buffer, 22);
+            card_try_render(count ? deck[count - 1] : CARD_NONE, x, y, selected == 1, buffer, 22);
             break;
         case Vertical:
-            if (deck && deck->count > 0)
-                deck_render_vertical(deck, x, y, selected, buffer);
+            if (count > 0)
+                deck_render_vertical(deck, count, first_exposed, x, y, selected, buffer);
             else if (draw_empty)
                 card_render_slot(x, y, selected == 1, buffer);
             break;
@@ -213,18 +189,3 @@ void deck_render(List *deck, DeckType type, int16_t x, int16_t y, int8_t selecte
             break;
     }
 }
-
-Card *deck_first_non_flipped(List *deck, int8_t *index) {
-    ListItem *curr = deck->head;
-    for (int8_t i = 0; i < (int8_t) deck->count; i++) {
-        if (!curr->data) break;
-        Card *card = (Card *) curr->data;
-        if (card->exposed) {
-            (*index) = i;
-            return card;
-        }
-        curr = curr->next;
-    }
-    (*index) = -1;
-    return NULL;
-}
\ No newline at end of file
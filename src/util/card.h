@@ -2,30 +2,19 @@
 
 #include <furi.h>
 #include "buffer.h"
-#include "list.h"
+#include "klondike.h"
+#include "frame_watchdog.h"
 
-typedef enum {
-    NONE = -1,
-    TWO = 0,        //1
-    THREE = 1,      //2
-    FOUR = 2,       //3
-    FIVE = 3,       //4
-    SIX = 4,        //5
-    SEVEN = 5,      //6
-    EIGHT = 6,      //7
-    NINE = 7,       //8
-    TEN = 8,        //9
-    JACK = 9,       //10
-    QUEEN = 10,     //11
-    KING = 11,      //12
-    ACE = 12,       //13
-} CardValue;
+#define DECK_SIZE CARD_COUNT
+#define DECK_SHUFFLE_STEP 4
 
+//Incremental Fisher-Yates shuffle so a deal can be prepared in the background
 typedef struct {
-    uint8_t suit;
-    CardValue value;
-    bool exposed;
-} Card;
+    uint8_t cards[DECK_SIZE];
+    uint8_t position;
+    bool ready;
+    uint32_t rng;
+} DeckShuffle;
 
 typedef enum {
     Normal,
@@ -34,22 +23,25 @@ typedef enum {
 } DeckType;
 
 
-void card_render_front(Card *c, int16_t x, int16_t y, bool selected, Buffer *buffer, uint8_t size_limit);
+void card_set_quality(RenderQuality quality);
+
+void card_render_front(Card c, int16_t x, int16_t y, bool selected, Buffer *buffer, uint8_t size_limit);
 
 void card_render_slot(int16_t x, int16_t y, bool selected, Buffer *buffer);
 
 void card_render_back(int16_t x, int16_t y, bool selected, Buffer *buffer, uint8_t size_limit);
 
-void card_try_render(Card *c, int16_t x, int16_t y, bool selected, Buffer *buffer, uint8_t size_limit);
-
-bool card_test_foundation(Card *data, Card *target);
-
-bool card_test_column(Card *data, Card *target);
+//renders an empty slot for CARD_NONE
+void card_try_render(Card c, int16_t x, int16_t y, bool selected, Buffer *buffer, uint8_t size_limit);
 
-List *deck_generate(uint8_t deck_count);
+//a shuffle with the same seed always gives the same deal as klondike_deal
+void deck_shuffle_start(DeckShuffle *shuffle, uint32_t seed);
 
-void deck_free(List *deck);
+bool deck_shuffle_step(void *ctx);
 
-Card* deck_first_non_flipped(List *deck, int8_t *index);
+//starts a new game with the shuffled cards face down in the deck pile
+void deck_from_shuffle(DeckShuffle *shuffle, Klondike *game);
 
-void deck_render(List *deck, DeckType type, int16_t x, int16_t y, int8_t selected, bool draw_empty, Buffer *buffer);
\ No newline at end of file
+//first_exposed is the index of the lowest face up card, -1 if there is none
+void deck_render(const Card *deck, uint8_t count, int8_t first_exposed, DeckType type, int16_t x, int16_t y,
+                 int8_t selected, bool draw_empty, Buffer *buffer);
\ No newline at end of file
@@ -0,0 +1,65 @@
+#include "frame_watchdog.h"
+#include <inttypes.h>
+
+//frames in a row over the budget before degrading
+#define DEGRADE_AFTER 3
+//frames in a row below RECOVER_PERCENT of the budget before restoring quality
+#define RECOVER_AFTER 30
+#define RECOVER_PERCENT 70
+#define LOG_INTERVAL 120
+
+#define TO_US(cycles) ((uint32_t) ((cycles) / 64))
+
+static const char *quality_names[] = {"full", "reduced", "minimal"};
+
+void watchdog_init(FrameWatchdog *watchdog, uint32_t budget) {
+    memset(watchdog, 0, sizeof(FrameWatchdog));
+    watchdog->budget = budget;
+    watchdog->quality = QualityFull;
+}
+
+static void set_quality(FrameWatchdog *watchdog, RenderQuality quality, uint32_t total) {
+    FURI_LOG_I("WATCHDOG",
+               "quality %s -> %s, frame %" PRIu32 "us (update %" PRIu32 "us render %" PRIu32 "us present %" PRIu32
+               "us)",
+               quality_names[watchdog->quality], quality_names[quality], TO_US(total),
+               TO_US(watchdog->update), TO_US(watchdog->render), TO_US(watchdog->present));
+    watchdog->quality = quality;
+    watchdog->over_budget = 0;
+    watchdog->headroom = 0;
+}
+
+bool watchdog_frame(FrameWatchdog *watchdog, uint32_t update, uint32_t render, uint32_t present) {
+    uint32_t total = update + render + present;
+    watchdog->update = update;
+    watchdog->render = render;
+    watchdog->present = present;
+    watchdog->average = watchdog->average ? (watchdog->average * 7 + total) / 8 : total;
+
+    if (++watchdog->frames >= LOG_INTERVAL) {
+        watchdog->frames = 0;
+        FURI_LOG_D("WATCHDOG",
+                   "avg %" PRIu32 "us last %" PRIu32 "us (update %" PRIu32 "us render %" PRIu32 "us present %" PRIu32
+                   "us) quality %s",
+                   TO_US(watchdog->average), TO_US(total), TO_US(update), TO_US(render), TO_US(present),
+                   quality_names[watchdog->quality]);
+    }
+
+    if (total > watchdog->budget) {
+        watchdog->headroom = 0;
+        if (++watchdog->over_budget >= DEGRADE_AFTER && watchdog->quality < QualityMinimal) {
+            set_quality(watchdog, watchdog->quality + 1, total);
+            return true;
+        }
+    } else if (watchdog->average * 100 < watchdog->budget * RECOVER_PERCENT) {
+        watchdog->over_budget = 0;
+        if (++watchdog->headroom >= RECOVER_AFTER && watchdog->quality > QualityFull) {
+            set_quality(watchdog, watchdog->quality - 1, total);
+            return true;
+        }
+    } else {
+        watchdog->over_budget = 0;
+        watchdog->headroom = 0;
+    }
+    return false;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <furi.h>
+
+typedef enum {
+    QualityFull,
+    //skip rotated sprites
+    QualityReduced,
+    //also shorten animations and batch the deal
+    QualityMinimal,
+} RenderQuality;
+
+typedef struct {
+    uint32_t budget;
+    uint32_t average;
+    uint32_t update;
+    uint32_t render;
+    uint32_t present;
+    uint8_t over_budget;
+    uint8_t headroom;
+    uint16_t frames;
+    RenderQuality quality;
+} FrameWatchdog;
+
+void watchdog_init(FrameWatchdog *watchdog, uint32_t budget);
+
+//feed the cost of each phase of a presented frame in cpu cycles, returns true if the quality changed
+bool watchdog_frame(FrameWatchdog *watchdog, uint32_t update, uint32_t render, uint32_t present);
@@ -2,6 +2,7 @@
 
 #include <furi.h>
 //#define DEBUG_BUILD
+//#define ALLOC_STATS
 
 #define M_PIX2        6.28318530717958647692    /* 2 pi */
 #define l_abs(x) ((x) < 0 ? -(x) : (x))
@@ -9,6 +10,8 @@
 #define RAD_2_DEG  565.48667764616278292327f
 
 
+#include "alloc_stats.h"
+
 #ifdef DEBUG_BUILD
 #define check_pointer(X) _check_ptr( X, __FILE__, __LINE__, __FUNCTION__)
 #else
@@ -0,0 +1,28 @@
+#include "hint.h"
+#include <string.h>
+
+void hint_start(Hint *hint, const Klondike *game) {
+    memcpy(hint->cards, game->board.cards, sizeof(hint->cards));
+    memcpy(hint->end, game->board.end, sizeof(hint->end));
+    hint->ready = false;
+    solver_start(&hint->solver, game, hint->table, HINT_TABLE_BITS, HINT_NODE_BUDGET);
+}
+
+bool hint_step(void *ctx) {
+    Hint *hint = (Hint *) ctx;
+    //the budget bounds the answer time, whatever looks best by then is suggested
+    if (!hint->ready) hint->ready = solver_run(&hint->solver, HINT_SLICE) != SolverRunning;
+    return hint->ready;
+}
+
+//the solver key merges the deck with the waste, a draw or a recycle has to restart the hint too
+bool hint_matches(const Hint *hint, const Klondike *game) {
+    return !memcmp(hint->cards, game->board.cards, sizeof(hint->cards)) &&
+           !memcmp(hint->end, game->board.end, sizeof(hint->end));
+}
+
+bool hint_move(const Hint *hint, Move *move) {
+    if (!hint->ready || !hint->solver.best_score || hint->solver.result == SolverUnsolvable) return false;
+    *move = hint->solver.best;
+    return true;
+}
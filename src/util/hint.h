@@ -0,0 +1,32 @@
+#pragma once
+
+#include "solver.h"
+
+//Suggests a move by searching the current position in small slices between frames
+
+//positions searched per answer, about a second of spare frame time on the device
+#define HINT_NODE_BUDGET 30000
+//positions searched per scheduler step
+#define HINT_SLICE 64
+#define HINT_TABLE_BITS 11
+
+typedef struct {
+    Solver solver;
+    uint32_t table[SOLVER_TABLE_SIZE(HINT_TABLE_BITS)];
+    //the position being searched as the piles hold it, the search works on its own copy of it
+    Card cards[CARD_COUNT];
+    uint8_t end[PileCount];
+    bool ready;
+} Hint;
+
+//starts searching the current position of game
+void hint_start(Hint *hint, const Klondike *game);
+
+//scheduler step, true once the answer is ready, it never looks at the game the hint was started from
+bool hint_step(void *ctx);
+
+//false once game moved on from the position being searched, the owner starts the hint over then
+bool hint_matches(const Hint *hint, const Klondike *game);
+
+//the suggested move, false if there is none (the game is won, stuck or can no longer be won)
+bool hint_move(const Hint *hint, Move *move);
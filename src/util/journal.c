@@ -0,0 +1,78 @@
+#include "journal.h"
+#include <string.h>
+
+void journal_apply(Board *board, const JournalEntry *entry) {
+    if (entry->flags & JournalFlip) {
+        board_set_exposed(board, entry->from, board_count(board, entry->from) - 1, true);
+        return;
+    }
+
+    board_move(board, entry->from, entry->to, entry->count);
+    uint8_t first = board_count(board, entry->to) - entry->count;
+    if (entry->flags & JournalTurnOver) {
+        board_reverse(board, entry->to, entry->count);
+        for (uint8_t i = 0; i < entry->count; i++) board_set_exposed(board, entry->to, first + i, false);
+    }
+    if (entry->flags & JournalExpose) {
+        for (uint8_t i = 0; i < entry->count; i++) board_set_exposed(board, entry->to, first + i, true);
+    }
+}
+
+void journal_revert(Board *board, const JournalEntry *entry) {
+    if (entry->flags & JournalFlip) {
+        board_set_exposed(board, entry->from, board_count(board, entry->from) - 1, false);
+        return;
+    }
+
+    uint8_t first = board_count(board, entry->to) - entry->count;
+    if (entry->flags & JournalExpose) {
+        for (uint8_t i = 0; i < entry->count; i++) board_set_exposed(board, entry->to, first + i, false);
+    }
+    if (entry->flags & JournalTurnOver) {
+        for (uint8_t i = 0; i < entry->count; i++) board_set_exposed(board, entry->to, first + i, true);
+        board_reverse(board, entry->to, entry->count);
+    }
+    board_move(board, entry->to, entry->from, entry->count);
+}
+
+void journal_clear(Journal *journal) {
+    memset(journal, 0, sizeof(Journal));
+}
+
+void journal_do(Journal *journal, Board *board, uint8_t from, uint8_t to, uint8_t count, uint8_t flags) {
+    JournalEntry *entry = &(journal->entries[journal->top]);
+    entry->from = from;
+    entry->to = to;
+    entry->count = count;
+    entry->flags = flags;
+    journal_apply(board, entry);
+
+    journal->top = (journal->top + 1) % JOURNAL_SIZE;
+    if (journal->undo_count < JOURNAL_SIZE) journal->undo_count++;
+    journal->redo_count = 0;
+}
+
+bool journal_undo(Journal *journal, Board *board) {
+    if (!journal->undo_count) return false;
+    bool chained;
+    do {
+        journal->top = (journal->top + JOURNAL_SIZE - 1) % JOURNAL_SIZE;
+        journal->undo_count--;
+        journal->redo_count++;
+        JournalEntry *entry = &(journal->entries[journal->top]);
+        journal_revert(board, entry);
+        chained = (entry->flags & JournalChain) && journal->undo_count;
+    } while (chained);
+    return true;
+}
+
+bool journal_redo(Journal *journal, Board *board) {
+    if (!journal->redo_count) return false;
+    do {
+        journal_apply(board, &(journal->entries[journal->top]));
+        journal->top = (journal->top + 1) % JOURNAL_SIZE;
+        journal->undo_count++;
+        journal->redo_count--;
+    } while (journal->redo_count && (journal->entries[journal->top].flags & JournalChain));
+    return true;
+}
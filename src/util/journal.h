@@ -0,0 +1,46 @@
+#pragma once
+
+#include "board.h"
+
+//Undo history of board moves in a fixed ring buffer, the oldest entries are dropped once it is full
+#define JOURNAL_SIZE 64
+
+typedef enum {
+    //turns the top card of the source face up, nothing moves
+    JournalFlip = 1 << 0,
+    //the moved cards end up face up, drawing from the deck
+    JournalExpose = 1 << 1,
+    //the moved cards are reversed and turned face down, recycling the waste
+    JournalTurnOver = 1 << 2,
+    //undone and redone together with the entry before it
+    JournalChain = 1 << 3,
+} JournalFlag;
+
+typedef struct {
+    uint8_t from;
+    uint8_t to;
+    uint8_t count;
+    uint8_t flags;
+} JournalEntry;
+
+typedef struct {
+    JournalEntry entries[JOURNAL_SIZE];
+    uint8_t top;
+    uint8_t undo_count;
+    uint8_t redo_count;
+} Journal;
+
+void journal_clear(Journal *journal);
+
+//applies the move to the board and records it, drops anything that could have been redone
+void journal_do(Journal *journal, Board *board, uint8_t from, uint8_t to, uint8_t count, uint8_t flags);
+
+//reverts the last move (and the ones chained to it), returns false if there is nothing to undo
+bool journal_undo(Journal *journal, Board *board);
+
+bool journal_redo(Journal *journal, Board *board);
+
+//applies or reverts a single entry without recording it, for searches that keep their own history
+void journal_apply(Board *board, const JournalEntry *entry);
+
+void journal_revert(Board *board, const JournalEntry *entry);
@@ -0,0 +1,220 @@
+#include "klondike.h"
+#include "rules.h"
+
+uint32_t klondike_random(uint32_t *state) {
+    uint32_t z = (*state += 0x9E3779B9);
+    z = (z ^ (z >> 16)) * 0x85EBCA6B;
+    z = (z ^ (z >> 13)) * 0xC2B2AE35;
+    return z ^ (z >> 16);
+}
+
+void klondike_shuffle(uint8_t *cards, uint8_t from, uint8_t to, uint32_t *rng) {
+    for (uint8_t i = from; i < to; i++) {
+        uint8_t r = i + (uint8_t) (((uint64_t) klondike_random(rng) * (CARD_COUNT - i)) >> 32);
+        uint8_t card = cards[i];
+        cards[i] = cards[r];
+        cards[r] = card;
+    }
+}
+
+void klondike_setup(Klondike *game, const uint8_t *cards) {
+    board_clear(&game->board);
+    journal_clear(&game->journal);
+    for (uint8_t i = 0; i < CARD_COUNT; i++) {
+        board_push(&game->board, PileDeck, cards[i]);
+    }
+}
+
+bool klondike_deal_card(Klondike *game, uint8_t column) {
+    uint8_t pile = PILE_TABLEAU(column);
+    if (board_count(&game->board, pile) <= column) {
+        board_move(&game->board, PileDeck, pile, 1);
+    }
+    if (board_count(&game->board, pile) == column + 1) {
+        board_set_exposed(&game->board, pile, column, true);
+        return true;
+    }
+    return false;
+}
+
+void klondike_deal(Klondike *game, uint32_t seed) {
+    uint8_t cards[CARD_COUNT];
+    for (uint8_t i = 0; i < CARD_COUNT; i++) cards[i] = i;
+    klondike_shuffle(cards, 0, CARD_COUNT, &seed);
+    klondike_setup(game, cards);
+    for (uint8_t column = 0; column < 7; column++) {
+        while (!klondike_deal_card(game, column));
+    }
+}
+
+static bool is_tableau(uint8_t pile) {
+    return pile >= PileTableau && pile < PileCount;
+}
+
+static bool is_foundation(uint8_t pile) {
+    return pile >= PileFoundation && pile < PileTableau;
+}
+
+//can the run starting with card go on top of pile
+static bool accepts(const Board *board, uint8_t pile, Card card, uint8_t count) {
+    Card top = board_peek(board, pile);
+    if (is_foundation(pile)) return count == 1 && rules_can_found(card, top);
+    if (is_tableau(pile)) return (top == CARD_NONE || card_is_exposed(top)) && rules_can_stack(card, top);
+    return false;
+}
+
+bool klondike_is_legal(const Klondike *game, const Move *move) {
+    const Board *board = &game->board;
+    switch (move->type) {
+        case MoveDraw:
+            return board_count(board, PileDeck) > 0;
+        case MoveRecycle:
+            return board_count(board, PileDeck) == 0 && board_count(board, PileWaste) > 0;
+        case MoveFlip: {
+            Card top = board_peek(board, move->from);
+            return is_tableau(move->from) && top != CARD_NONE && !card_is_exposed(top);
+        }
+        case MovePile: {
+            uint8_t count = board_count(board, move->from);
+            if (move->from == move->to || !move->count || move->count > count) return false;
+            //only face up cards of the waste and the tableau can be picked up
+            if (move->from == PileWaste) {
+                if (move->count != 1) return false;
+            } else if (!is_tableau(move->from) || move->count > count - board_hidden(board, move->from)) {
+                return false;
+            }
+            return accepts(board, move->to, board_peek_index(board, move->from, count - move->count), move->count);
+        }
+        default:
+            return false;
+    }
+}
+
+uint16_t klondike_destinations(const Klondike *game, uint8_t from, uint8_t count) {
+    uint16_t targets = 0;
+    Move move = {MovePile, from, PileFoundation, count};
+    for (; move.to < PileCount; move.to++) {
+        if (klondike_is_legal(game, &move)) targets |= 1 << move.to;
+    }
+    return targets;
+}
+
+static void add(Move *moves, uint8_t *count, uint8_t type, uint8_t from, uint8_t to, uint8_t cards) {
+    Move *move = &(moves[(*count)++]);
+    move->type = type;
+    move->from = from;
+    move->to = to;
+    move->count = cards;
+}
+
+//takes the lowest card id out of a card set
+static uint8_t next_card(uint64_t *set) {
+    uint8_t id = (uint8_t) __builtin_ctzll(*set);
+    *set &= *set - 1;
+    return id;
+}
+
+uint8_t klondike_generate_moves(const Klondike *game, Move *moves) {
+    const Board *board = &game->board;
+    uint8_t count = 0;
+
+    if (board_count(board, PileDeck)) add(moves, &count, MoveDraw, PileDeck, PileWaste, 1);
+    else if (board_count(board, PileWaste)) add(moves, &count, MoveRecycle, PileWaste, PileDeck, 0);
+
+    //tops are the single cards a foundation can take, movable every card that starts a run that can be picked up
+    Card waste = board_peek(board, PileWaste);
+    uint64_t tops = waste != CARD_NONE ? card_bit(waste) : 0;
+    uint64_t tableau = 0;
+    for (uint8_t from = PileTableau; from < PileCount; from++) {
+        Card top = board_peek(board, from);
+        if (top == CARD_NONE) continue;
+        if (!card_is_exposed(top)) {
+            add(moves, &count, MoveFlip, from, from, 0);
+            continue;
+        }
+        tops |= card_bit(top);
+        tableau |= board->pile_set[from];
+    }
+    uint64_t movable = (tableau & board->exposed) | tops;
+
+    for (uint8_t to = PileFoundation; to < PileTableau; to++) {
+        Card top = board_peek(board, to);
+        uint64_t set = (top == CARD_NONE ? rules_aces : 1ULL << rules_foundation_next[card_id(top)]) & tops;
+        while (set) {
+            add(moves, &count, MovePile, board->pile_of[next_card(&set)], to, 1);
+        }
+    }
+
+    //every run is an ordered sequence, so each target can take at most one card of a column
+    for (uint8_t to = PileTableau; to < PileCount; to++) {
+        Card top = board_peek(board, to);
+        if (top != CARD_NONE && !card_is_exposed(top)) continue;
+        uint64_t set = (top == CARD_NONE ? rules_kings : rules_stack_mask[card_id(top)]) & movable &
+                       ~board->pile_set[to];
+        while (set) {
+            uint8_t id = next_card(&set);
+            uint8_t from = board->pile_of[id];
+            add(moves, &count, MovePile, from, to, board_count(board, from) - board->index_of[id]);
+        }
+    }
+    return count;
+}
+
+JournalEntry klondike_move_entry(const Klondike *game, const Move *move) {
+    switch (move->type) {
+        case MoveDraw:
+            return (JournalEntry) {PileDeck, PileWaste, 1, JournalExpose};
+        case MoveRecycle:
+            return (JournalEntry) {PileWaste, PileDeck, board_count(&game->board, PileWaste), JournalTurnOver};
+        case MoveFlip:
+            return (JournalEntry) {move->from, move->from, 0, JournalFlip};
+        default:
+            return (JournalEntry) {move->from, move->to, move->count, 0};
+    }
+}
+
+void klondike_apply_move(Klondike *game, const Move *move) {
+    JournalEntry entry = klondike_move_entry(game, move);
+    journal_do(&game->journal, &game->board, entry.from, entry.to, entry.count, entry.flags);
+}
+
+void klondike_apply_chained(Klondike *game, const Move *move) {
+    JournalEntry entry = klondike_move_entry(game, move);
+    journal_do(&game->journal, &game->board, entry.from, entry.to, entry.count, entry.flags | JournalChain);
+}
+
+bool klondike_safe_move(const Klondike *game, Move *move) {
+    const Board *board = &game->board;
+    uint64_t founded = 0;
+    for (uint8_t i = 0; i < 4; i++) founded |= board->pile_set[PILE_FOUNDATION(i)];
+
+    //the waste top and the tableau tops, the only cards that can be played
+    for (uint8_t from = PileWaste; from < PileCount; from = from == PileWaste ? PileTableau : from + 1) {
+        Card card = board_peek(board, from);
+        if (card == CARD_NONE || !card_is_exposed(card) || (rules_stack_mask[card_id(card)] & ~founded)) continue;
+        for (uint8_t to = PileFoundation; to < PileTableau; to++) {
+            if (rules_can_found(card, board_peek(board, to))) {
+                *move = (Move) {MovePile, from, to, 1};
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool klondike_undo_move(Klondike *game) {
+    return journal_undo(&game->journal, &game->board);
+}
+
+bool klondike_redo_move(Klondike *game) {
+    return journal_redo(&game->journal, &game->board);
+}
+
+bool klondike_is_revealed(const Klondike *game) {
+    const Board *board = &game->board;
+    return board->hidden_total == board_hidden(board, PileDeck) + board_hidden(board, PileWaste);
+}
+
+bool klondike_is_won(const Klondike *game) {
+    return board_on_foundation(&game->board) == CARD_COUNT;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "board.h"
+#include "journal.h"
+
+//Klondike rules on top of the board, no furi or gui dependencies so it also builds on a desktop
+
+//enough for every legal move of any position
+#define KLONDIKE_MAX_MOVES 96
+
+typedef struct {
+    Board board;
+    Journal journal;
+} Klondike;
+
+typedef enum {
+    //top of the deck to the waste, face up
+    MoveDraw,
+    //the whole waste back to the deck, face down
+    MoveRecycle,
+    //turn the top card of a tableau column face up
+    MoveFlip,
+    //the top count cards of a pile onto another pile
+    MovePile,
+} MoveType;
+
+typedef struct {
+    uint8_t type;
+    uint8_t from;
+    uint8_t to;
+    uint8_t count;
+} Move;
+
+//portable generator, the same seed gives the same deal on every platform
+uint32_t klondike_random(uint32_t *state);
+
+//Fisher-Yates swaps for positions from..to-1, a deck shuffled in slices ends up the same as one shuffled at once
+void klondike_shuffle(uint8_t *cards, uint8_t from, uint8_t to, uint32_t *rng);
+
+//fresh board with every card in the deck, the last one on top
+void klondike_setup(Klondike *game, const uint8_t *cards);
+
+//deals one card from the deck to column, the last card of a full column is turned face up
+//returns true once the column has its column + 1 cards
+bool klondike_deal_card(Klondike *game, uint8_t column);
+
+//shuffles with the seed and deals the whole game at once
+void klondike_deal(Klondike *game, uint32_t seed);
+
+bool klondike_is_legal(const Klondike *game, const Move *move);
+
+//piles the top count cards of from can be moved to, bit n stands for pile n
+uint16_t klondike_destinations(const Klondike *game, uint8_t from, uint8_t count);
+
+//fills moves with every legal move and returns how many there are
+//works on the card sets of the board, the moves come out in no particular order
+uint8_t klondike_generate_moves(const Klondike *game, Move *moves);
+
+//the board change move makes in the current position
+JournalEntry klondike_move_entry(const Klondike *game, const Move *move);
+
+void klondike_apply_move(Klondike *game, const Move *move);
+
+//applies move as part of the one before it, they are undone and redone together
+void klondike_apply_chained(Klondike *game, const Move *move);
+
+//finds a card that can go to its foundation while nothing can be stacked on it anymore, playing it never takes a
+//choice away, so it is safe to do automatically
+//in this game a KING may go on an ACE, so an ACE only counts once both opposite colour KINGs are on the foundations
+bool klondike_safe_move(const Klondike *game, Move *move);
+
+//reverts the last applied move, false if the journal is empty
+bool klondike_undo_move(Klondike *game);
+
+bool klondike_redo_move(Klondike *game);
+
+//only the stock may still hold face down cards
+bool klondike_is_revealed(const Klondike *game);
+
+bool klondike_is_won(const Klondike *game);
@@ -0,0 +1,39 @@
+#include "rating.h"
+
+void rating_start(Rating *rating, const Klondike *game) {
+    rating->deal = *game;
+    for (uint8_t column = 0; column < 7; column++) {
+        while (!klondike_deal_card(&rating->deal, column));
+    }
+    rating->ready = false;
+    solver_start(&rating->solver, &rating->deal, rating->table, RATING_TABLE_BITS, RATING_NODE_BUDGET);
+}
+
+bool rating_step(void *ctx) {
+    Rating *rating = (Rating *) ctx;
+    if (!rating->ready) rating->ready = solver_run(&rating->solver, RATING_SLICE) != SolverRunning;
+    return rating->ready;
+}
+
+//points for the effort to find a win, with one more each for a search that mostly hit dead ends and for positions
+//with few moves to choose from
+//on the winnable seeds this puts about 30% of the deals in Easy, 35% in Medium, 10% in Hard and 25% in Expert
+RatingLevel rating_level(const Rating *rating) {
+    const Solver *solver = &rating->solver;
+    if (!rating->ready) return RatingNone;
+
+    uint8_t points = 3;
+    if (solver->result == SolverSolved) points = solver->nodes <= 150 ? 0 : solver->nodes <= 1000 ? 1 : 2;
+    if (solver->dead_ends * 2 > solver->expanded) points++;
+    if (solver->branches * 10 < solver->expanded * 34) points++;
+
+    if (points == 0) return RatingEasy;
+    if (points <= 2) return RatingMedium;
+    if (points == 3) return RatingHard;
+    return RatingExpert;
+}
+
+const char *rating_name(RatingLevel level) {
+    static const char *names[] = {"unrated", "Easy", "Medium", "Hard", "Expert"};
+    return names[level];
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "solver.h"
+
+//Rates how hard a deal is with a bounded search, run in small slices while the deal is animated
+
+//positions searched at most, a few seconds of spare frame time on the device
+#define RATING_NODE_BUDGET 20000
+//positions searched per scheduler step, small enough to fit next to the deal animation
+#define RATING_SLICE 64
+#define RATING_TABLE_BITS 11
+
+typedef enum {
+    //the search has not finished yet
+    RatingNone,
+    RatingEasy,
+    RatingMedium,
+    RatingHard,
+    RatingExpert,
+} RatingLevel;
+
+typedef struct {
+    Solver solver;
+    uint32_t table[SOLVER_TABLE_SIZE(RATING_TABLE_BITS)];
+    Klondike deal;
+    bool ready;
+} Rating;
+
+//starts rating game, a fresh deal with every card still in the deck, the tableau is dealt on a copy
+void rating_start(Rating *rating, const Klondike *game);
+
+//scheduler step, true once the rating is ready
+bool rating_step(void *ctx);
+
+RatingLevel rating_level(const Rating *rating);
+
+const char *rating_name(RatingLevel level);
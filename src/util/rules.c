@@ -0,0 +1,53 @@
+#include "rules.h"
+
+//expands M for every card, in card id order
+#define RULES_SUIT(M, s) \
+    M(s, 0), M(s, 1), M(s, 2), M(s, 3), M(s, 4), M(s, 5), M(s, 6), \
+    M(s, 7), M(s, 8), M(s, 9), M(s, 10), M(s, 11), M(s, 12)
+#define RULES_DECK(M) RULES_SUIT(M, 0), RULES_SUIT(M, 1), RULES_SUIT(M, 2), RULES_SUIT(M, 3)
+
+#define CARD_BIT(s, v) (1ULL << card_make(s, v))
+
+//one rank lower in the other colour, nothing goes below a TWO (the rank before it wraps around to ACE)
+#define STACK_MASK(s, v) \
+    ((v) == TWO ? 0 : CARD_BIT(((s) + 1) % 2, ((v) + 12) % 13) | CARD_BIT(((s) + 1) % 2 + 2, ((v) + 12) % 13))
+
+//foundations run ACE, TWO ... KING
+#define FOUNDATION_NEXT(s, v) card_make(s, ((v) + 1) % 13)
+
+const uint64_t rules_stack_mask[CARD_COUNT] = {RULES_DECK(STACK_MASK)};
+
+const Card rules_foundation_next[CARD_COUNT] = {RULES_DECK(FOUNDATION_NEXT)};
+
+#define RANK_SET(v) (CARD_BIT(0, v) | CARD_BIT(1, v) | CARD_BIT(2, v) | CARD_BIT(3, v))
+
+const uint64_t rules_aces = RANK_SET(ACE);
+const uint64_t rules_kings = RANK_SET(KING);
+
+static bool reference_foundation(Card data, Card target) {
+    if (target == CARD_NONE) return card_value(data) == ACE;
+    return card_suit(target) == card_suit(data) && ((card_value(target) + 1) % 13 == card_value(data));
+}
+
+static bool reference_column(Card data, Card target) {
+    if (target == CARD_NONE) return card_value(data) == KING;
+    return card_suit(target) % 2 == (card_suit(data) + 1) % 2 && (card_value(data) + 1) == card_value(target);
+}
+
+uint16_t rules_self_check() {
+    uint16_t mismatches = 0;
+    for (uint8_t data = 0; data < CARD_COUNT; data++) {
+        for (uint16_t t = 0; t <= CARD_COUNT; t++) {
+            Card target = t == CARD_COUNT ? CARD_NONE : (Card) t;
+            //the exposed flag must not change the answer
+            Card shown = data | CARD_EXPOSED;
+            if (rules_can_stack(data, target) != reference_column(data, target)) mismatches++;
+            if (rules_can_stack(shown, target) != reference_column(data, target)) mismatches++;
+            if (rules_can_found(data, target) != reference_foundation(data, target)) mismatches++;
+            if (rules_can_found(shown, target) != reference_foundation(data, target)) mismatches++;
+        }
+        if (((rules_aces >> data) & 1) != reference_foundation(data, CARD_NONE)) mismatches++;
+        if (((rules_kings >> data) & 1) != reference_column(data, CARD_NONE)) mismatches++;
+    }
+    return mismatches;
+}
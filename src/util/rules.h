@@ -0,0 +1,24 @@
+#pragma once
+
+#include "board.h"
+
+//Move legality as lookup tables over the 52 card ids, filled in by the preprocessor at build time
+
+//bit n of rules_stack_mask[target] is set when card id n may be placed on target in the tableau
+extern const uint64_t rules_stack_mask[CARD_COUNT];
+
+//the only card that may follow target on a foundation
+extern const Card rules_foundation_next[CARD_COUNT];
+
+//card sets of what an empty foundation and an empty tableau column take
+extern const uint64_t rules_aces;
+extern const uint64_t rules_kings;
+
+#define rules_can_stack(card, target) \
+    ((target) == CARD_NONE ? card_value(card) == KING : ((rules_stack_mask[card_id(target)] >> card_id(card)) & 1) != 0)
+
+#define rules_can_found(card, target) \
+    ((target) == CARD_NONE ? card_value(card) == ACE : rules_foundation_next[card_id(target)] == card_id(card))
+
+//compares every table entry with the arithmetic rules they were derived from, returns the number of mismatches
+uint16_t rules_self_check();
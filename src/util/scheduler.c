@@ -0,0 +1,77 @@
+#include "scheduler.h"
+#include "helpers.h"
+
+void scheduler_init(Scheduler *scheduler) {
+    memset(scheduler, 0, sizeof(Scheduler));
+}
+
+static SchedulerJob *find_job(Scheduler *scheduler, SchedulerStep step, void *ctx) {
+    for (uint8_t i = 0; i < SCHEDULER_MAX_JOBS; i++) {
+        SchedulerJob *job = &(scheduler->jobs[i]);
+        if (job->step == step && job->ctx == ctx) return job;
+    }
+    return NULL;
+}
+
+bool scheduler_add(Scheduler *scheduler, SchedulerStep step, void *ctx) {
+    if (find_job(scheduler, step, ctx)) return true;
+
+    SchedulerJob *job = find_job(scheduler, NULL, NULL);
+    if (!job) {
+        FURI_LOG_W("SCHEDULER", "No free job slot");
+        return false;
+    }
+    job->step = step;
+    job->ctx = ctx;
+    job->step_cost = 0;
+    return true;
+}
+
+void scheduler_cancel(Scheduler *scheduler, SchedulerStep step, void *ctx) {
+    SchedulerJob *job = find_job(scheduler, step, ctx);
+    if (job) {
+        job->step = NULL;
+        job->ctx = NULL;
+    }
+}
+
+bool scheduler_pending(Scheduler *scheduler, SchedulerStep step, void *ctx) {
+    return find_job(scheduler, step, ctx) != NULL;
+}
+
+void scheduler_run(Scheduler *scheduler, uint32_t budget) {
+    size_t start = curr_time();
+    uint8_t idle = 0;
+    uint8_t ran = 0;
+
+    //stop when a full round found nothing that fits into the remaining time
+    while (idle < SCHEDULER_MAX_JOBS) {
+        SchedulerJob *job = &(scheduler->jobs[scheduler->next]);
+        scheduler->next = (scheduler->next + 1) % SCHEDULER_MAX_JOBS;
+
+        uint32_t used = curr_time() - start;
+        if (!job->step || used + job->step_cost > budget) {
+            idle++;
+            continue;
+        }
+        idle = 0;
+        ran |= 1 << (job - scheduler->jobs);
+
+        size_t step_start = curr_time();
+        bool done = job->step(job->ctx);
+        uint32_t cost = curr_time() - step_start;
+
+        //keep the worst case, slowly forgetting old spikes
+        job->step_cost = MAX(cost, job->step_cost - job->step_cost / 8);
+        if (done) {
+            job->step = NULL;
+            job->ctx = NULL;
+        }
+    }
+
+    //a job that was left out forgets its cost the same way, so one slow step can't keep it waiting forever
+    for (uint8_t i = 0; i < SCHEDULER_MAX_JOBS; i++) {
+        SchedulerJob *job = &(scheduler->jobs[i]);
+        if (job->step && !(ran & (1 << i))) job->step_cost -= job->step_cost / 8;
+    }
+}
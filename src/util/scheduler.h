@@ -0,0 +1,31 @@
+#pragma once
+
+#include <furi.h>
+
+#define SCHEDULER_MAX_JOBS 4
+
+//Runs one small slice of work, returns true once the job is finished
+typedef bool (*SchedulerStep)(void *ctx);
+
+typedef struct {
+    SchedulerStep step;
+    void *ctx;
+    uint32_t step_cost;
+} SchedulerJob;
+
+typedef struct {
+    SchedulerJob jobs[SCHEDULER_MAX_JOBS];
+    uint8_t next;
+} Scheduler;
+
+void scheduler_init(Scheduler *scheduler);
+
+bool scheduler_add(Scheduler *scheduler, SchedulerStep step, void *ctx);
+
+void scheduler_cancel(Scheduler *scheduler, SchedulerStep step, void *ctx);
+
+bool scheduler_pending(Scheduler *scheduler, SchedulerStep step, void *ctx);
+
+//Round-robins the registered jobs until the budget (in cpu cycles) is used up
+//jobs run without the update mutex, they must not touch anything the input callback does
+void scheduler_run(Scheduler *scheduler, uint32_t budget);
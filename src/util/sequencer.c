@@ -0,0 +1,169 @@
+#include "sequencer.h"
+#include <notification/notification_messages.h>
+#include "helpers.h"
+
+static const NotificationSequence sequence_fail = {
+    &message_vibro_on,
+    &message_note_c4,
+    &message_delay_10,
+    &message_vibro_off,
+    &message_sound_off,
+    &message_delay_10,
+
+    &message_vibro_on,
+    &message_note_a3,
+    &message_delay_10,
+    &message_vibro_off,
+    &message_sound_off,
+    NULL,
+};
+
+static const NotificationSequence sequence_bounce = {
+    &message_vibro_on,
+    &message_delay_10,
+    &message_vibro_off,
+    NULL,
+};
+
+static const NotificationSequence sequence_cheer = {
+    &message_note_c4,
+    &message_delay_100,
+    &message_note_e4,
+    &message_delay_100,
+    &message_note_g4,
+    &message_delay_100,
+    &message_note_a4,
+    &message_delay_100,
+    &message_sound_off,
+    NULL,
+};
+
+static const NotificationSequence sequence_silence = {
+    &message_sound_off,
+    NULL,
+};
+
+typedef struct {
+    const NotificationSequence *sequence;
+    uint16_t min_interval;
+} CueSettings;
+
+static const CueSettings cues[CueCount] = {
+    [CueFail]={&sequence_fail, 150},
+    [CueBounce]={&sequence_bounce, 60},
+    [CueCheer]={&sequence_cheer, 0},
+};
+
+struct Sequencer {
+    NotificationApp *app;
+    FuriTimer *timer;
+
+    const SequencerPattern *pattern;
+    uint8_t row;
+    uint16_t row_elapsed;
+    bool pattern_changed;
+
+    //two slots, the notification service may still read the previous note while the next one is written
+    NotificationMessage note[2];
+    const NotificationMessage *note_sequence[2][2];
+    uint8_t note_slot;
+
+    volatile uint32_t pending;
+    uint32_t last_played[CueCount];
+};
+
+static void play_row(Sequencer *sequencer, const SequencerPattern *pattern) {
+    uint8_t midi = pattern->rows[sequencer->row];
+    sequencer->row = (sequencer->row + 1) % pattern->length;
+
+    if (midi == 0) {
+        notification_message(sequencer->app, &sequence_silence);
+        return;
+    }
+
+    uint8_t slot = sequencer->note_slot;
+    sequencer->note_slot ^= 1;
+    sequencer->note[slot].type = NotificationMessageTypeSoundOn;
+    sequencer->note[slot].data.sound.frequency = 440.0f * powf(2.0f, ((float) midi - 69.0f) / 12.0f);
+    sequencer->note[slot].data.sound.volume = pattern->volume;
+    notification_message(sequencer->app, (const NotificationSequence *) sequencer->note_sequence[slot]);
+}
+
+static void sequencer_tick(void *ctx) {
+    Sequencer *sequencer = (Sequencer *) ctx;
+
+    FURI_CRITICAL_ENTER();
+    uint32_t pending = sequencer->pending;
+    sequencer->pending = 0;
+    bool changed = sequencer->pattern_changed;
+    sequencer->pattern_changed = false;
+    const SequencerPattern *pattern = sequencer->pattern;
+    FURI_CRITICAL_EXIT();
+
+    uint32_t now = furi_get_tick();
+    for (uint8_t i = 0; i < CueCount; i++) {
+        if (!(pending & (1 << i))) continue;
+        //drop the cue if the same one went out recently, a burst of inputs should buzz once
+        if (sequencer->last_played[i] && (now - sequencer->last_played[i]) < furi_ms_to_ticks(cues[i].min_interval))
+            continue;
+        sequencer->last_played[i] = now;
+        notification_message(sequencer->app, cues[i].sequence);
+    }
+
+    if (changed) {
+        sequencer->row = 0;
+        sequencer->row_elapsed = 0;
+        if (pattern) {
+            play_row(sequencer, pattern);
+        } else {
+            notification_message(sequencer->app, &sequence_silence);
+        }
+        return;
+    }
+
+    if (!pattern) return;
+
+    sequencer->row_elapsed += SEQUENCER_TICK_MS;
+    if (sequencer->row_elapsed >= pattern->row_ms) {
+        sequencer->row_elapsed = 0;
+        play_row(sequencer, pattern);
+    }
+}
+
+Sequencer *sequencer_alloc(NotificationApp *app) {
+    Sequencer *sequencer = malloc(sizeof(Sequencer));
+    memset(sequencer, 0, sizeof(Sequencer));
+    sequencer->app = app;
+    for (uint8_t i = 0; i < 2; i++) {
+        sequencer->note_sequence[i][0] = &(sequencer->note[i]);
+        sequencer->note_sequence[i][1] = NULL;
+    }
+    sequencer->timer = furi_timer_alloc(sequencer_tick, FuriTimerTypePeriodic, sequencer);
+    furi_timer_start(sequencer->timer, furi_ms_to_ticks(SEQUENCER_TICK_MS));
+    return sequencer;
+}
+
+void sequencer_free(Sequencer *sequencer) {
+    if (!check_pointer(sequencer)) return;
+    furi_timer_stop(sequencer->timer);
+    furi_timer_free(sequencer->timer);
+    notification_message_block(sequencer->app, &sequence_silence);
+    free(sequencer);
+}
+
+void sequencer_play(Sequencer *sequencer, const SequencerPattern *pattern) {
+    FURI_CRITICAL_ENTER();
+    sequencer->pattern = pattern;
+    sequencer->pattern_changed = true;
+    FURI_CRITICAL_EXIT();
+}
+
+void sequencer_stop(Sequencer *sequencer) {
+    sequencer_play(sequencer, NULL);
+}
+
+void sequencer_cue(Sequencer *sequencer, SequencerCue cue) {
+    FURI_CRITICAL_ENTER();
+    sequencer->pending |= 1 << cue;
+    FURI_CRITICAL_EXIT();
+}
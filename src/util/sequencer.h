@@ -0,0 +1,35 @@
+#pragma once
+
+#include <furi.h>
+#include <notification/notification.h>
+
+#define SEQUENCER_TICK_MS 10
+
+//Tracker style pattern, one byte per row: MIDI note number or 0 for silence
+typedef struct {
+    const uint8_t *rows;
+    uint8_t length;
+    uint16_t row_ms;
+    float volume;
+} SequencerPattern;
+
+//Short sound and haptic effects, requests for the same cue are coalesced and rate limited
+typedef enum {
+    CueFail,
+    CueBounce,
+    CueCheer,
+    CueCount
+} SequencerCue;
+
+typedef struct Sequencer Sequencer;
+
+Sequencer *sequencer_alloc(NotificationApp *app);
+
+void sequencer_free(Sequencer *sequencer);
+
+//Loops the pattern until stopped, never blocks the caller
+void sequencer_play(Sequencer *sequencer, const SequencerPattern *pattern);
+
+void sequencer_stop(Sequencer *sequencer);
+
+void sequencer_cue(Sequencer *sequencer, SequencerCue cue);
@@ -0,0 +1,288 @@
+#include "solver.h"
+#include "rules.h"
+#include <string.h>
+
+//Zobrist key of a card in a pile, derived with splitmix64 instead of stored in a table
+//Positions that can't be told apart by the rest of the game hash the same: the foundations are interchangeable,
+//and with endless recycling every stock card can always be drawn, so deck and waste are one pile
+static uint64_t card_key(Card card, uint8_t pile) {
+    bool exposed = pile >= PileTableau && card_is_exposed(card);
+    if (pile == PileWaste) pile = PileDeck;
+    if (pile >= PileFoundation && pile < PileTableau) pile = PileFoundation;
+    uint64_t z = ((uint64_t) (card_id(card) | pile << 6 | exposed << 10) + 1) * 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+//the order of every pile follows from which cards it holds, so the keys of its cards are enough
+static uint64_t run_key(const Board *board, uint8_t pile, uint8_t count) {
+    uint64_t key = 0;
+    uint8_t size = board_count(board, pile);
+    for (uint8_t i = size - count; i < size; i++) key ^= card_key(board_peek_index(board, pile, i), pile);
+    return key;
+}
+
+static uint8_t entry_cards(const JournalEntry *entry) {
+    return entry->flags & JournalFlip ? 1 : entry->count;
+}
+
+static void apply(Solver *solver, const JournalEntry *entry) {
+    solver->hash ^= run_key(&solver->game.board, entry->from, entry_cards(entry));
+    journal_apply(&solver->game.board, entry);
+    solver->hash ^= run_key(&solver->game.board, entry->to, entry_cards(entry));
+}
+
+static void revert(Solver *solver, const JournalEntry *entry) {
+    solver->hash ^= run_key(&solver->game.board, entry->to, entry_cards(entry));
+    journal_revert(&solver->game.board, entry);
+    solver->hash ^= run_key(&solver->game.board, entry->from, entry_cards(entry));
+}
+
+//marks the current position as visited, false if it already was
+//the low bits pick the slot, the high half is kept to tell positions apart
+#define TABLE_PROBES 4
+
+static bool visit(Solver *solver) {
+    uint32_t tag = (uint32_t) (solver->hash >> 32) | 1;
+    uint32_t slot = (uint32_t) solver->hash;
+    for (uint8_t i = 0; i < TABLE_PROBES; i++) {
+        uint32_t *entry = &(solver->table[(slot + i) & solver->table_mask]);
+        if (*entry == tag) return false;
+        if (*entry == 0) {
+            *entry = tag;
+            return true;
+        }
+    }
+    //a full neighbourhood forgets its first position, at worst it is searched again
+    solver->table[slot & solver->table_mask] = tag;
+    return true;
+}
+
+static uint64_t foundation_set(const Board *board) {
+    uint64_t set = 0;
+    for (uint8_t i = 0; i < 4; i++) set |= board->pile_set[PILE_FOUNDATION(i)];
+    return set;
+}
+
+//moves from the deck stand for drawing (and recycling) until the card with id count is on top of the waste,
+//then playing it to the target
+#define STOCK_CARD(move) ((move)->from == PileDeck)
+
+//24 stock cards drawn once each at most, a recycle and the play itself
+#define STOCK_MOVE_MAX 26
+
+static uint8_t move_rank(const Board *board, const Move *move) {
+    if (move->to < PileTableau) return 4;
+    if (move->from == PileWaste) return 2;
+    if (STOCK_CARD(move)) return 0;
+    //runs that turn a card face up or empty their column first
+    return board_count(board, move->from) - move->count <= board_hidden(board, move->from) ? 3 : 1;
+}
+
+static Card move_card(const Board *board, const Move *move) {
+    if (STOCK_CARD(move)) return move->count;
+    return board_peek_index(board, move->from, board_count(board, move->from) - move->count);
+}
+
+//the cards of the stock that can be played somewhere, the waste top is already covered by the move generator
+static uint8_t add_stock_moves(const Board *board, Move *moves, uint8_t count) {
+    uint64_t stock = (board->pile_set[PileDeck] | board->pile_set[PileWaste]);
+    if (board_count(board, PileWaste)) stock &= ~card_bit(board_peek(board, PileWaste));
+
+    for (uint8_t to = PileFoundation; to < PileCount; to++) {
+        Card top = board_peek(board, to);
+        uint64_t set;
+        if (to < PileTableau) set = top == CARD_NONE ? rules_aces : 1ULL << rules_foundation_next[card_id(top)];
+        else if (top == CARD_NONE) set = rules_kings;
+        else if (card_is_exposed(top)) set = rules_stack_mask[card_id(top)];
+        else continue;
+
+        for (set &= stock; set; set &= set - 1) {
+            moves[count++] = (Move) {MovePile, PileDeck, to, (uint8_t) __builtin_ctzll(set)};
+        }
+    }
+    return count;
+}
+
+//legal moves of the current position, best first
+//a face down top card or a card nothing can go on anymore has only one sensible move, so that is all it gets
+static uint8_t order_moves(Solver *solver) {
+    const Board *board = &solver->game.board;
+    Move *moves = solver->moves;
+    uint8_t count = add_stock_moves(board, moves, klondike_generate_moves(&solver->game, moves));
+    uint64_t founded = foundation_set(board);
+    uint8_t empty_foundation = PILE_NONE;
+    for (uint8_t i = 0; i < 4 && empty_foundation == PILE_NONE; i++) {
+        if (!board_count(board, PILE_FOUNDATION(i))) empty_foundation = PILE_FOUNDATION(i);
+    }
+
+    uint8_t kept = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        Move move = moves[i];
+        //drawing is part of playing a stock card
+        if (move.type == MoveDraw || move.type == MoveRecycle) continue;
+        if (move.type == MoveFlip) {
+            moves[0] = move;
+            return 1;
+        }
+        Card card = move_card(board, &move);
+        if (move.to < PileTableau) {
+            //an ace only needs to try one of the empty foundations
+            if (board_count(board, move.to) == 0 && move.to != empty_foundation) continue;
+            if ((rules_stack_mask[card_id(card)] & ~founded) == 0) {
+                moves[0] = move;
+                return 1;
+            }
+        }
+        //a whole column moved to an empty one only swaps columns
+        if (move.to >= PileTableau && board_count(board, move.to) == 0 && !STOCK_CARD(&move) &&
+            board_count(board, move.from) == move.count)
+            continue;
+
+        //insertion sort, the lists are short
+        uint8_t rank = move_rank(board, &move);
+        uint8_t at = kept++;
+        while (at > 0 && move_rank(board, &moves[at - 1]) < rank) {
+            moves[at] = moves[at - 1];
+            at--;
+        }
+        moves[at] = move;
+    }
+    return kept;
+}
+
+static void push(Solver *solver, JournalEntry entry, bool chain) {
+    if (chain) entry.flags |= JournalChain;
+    solver->path[solver->depth++] = entry;
+    apply(solver, &(solver->path[solver->depth - 1]));
+}
+
+//plays move as one or more path entries, chained so they are taken back together
+static void play(Solver *solver, const Move *move) {
+    Board *board = &solver->game.board;
+    bool chain = false;
+    if (STOCK_CARD(move)) {
+        while (board_peek(board, PileWaste) == CARD_NONE || card_id(board_peek(board, PileWaste)) != move->count) {
+            Move draw = {board_count(board, PileDeck) ? MoveDraw : MoveRecycle, 0, 0, 0};
+            push(solver, klondike_move_entry(&solver->game, &draw), chain);
+            chain = true;
+        }
+        Move place = {MovePile, PileWaste, move->to, 1};
+        push(solver, klondike_move_entry(&solver->game, &place), chain);
+    } else {
+        push(solver, klondike_move_entry(&solver->game, move), false);
+    }
+}
+
+//takes back the last move played, with everything chained to it
+static void take_back(Solver *solver) {
+    JournalEntry *entry;
+    do {
+        entry = &(solver->path[--solver->depth]);
+        revert(solver, entry);
+    } while (entry->flags & JournalChain);
+}
+
+uint64_t solver_position_key(const Board *board) {
+    uint64_t key = 0;
+    for (uint8_t pile = 0; pile < PileCount; pile++) key ^= run_key(board, pile, board_count(board, pile));
+    return key;
+}
+
+void solver_start(Solver *solver, const Klondike *game, uint32_t *table, uint8_t table_bits, uint32_t node_budget) {
+    solver->game = *game;
+    journal_clear(&solver->game.journal);
+    solver->hash = solver_position_key(&solver->game.board);
+    solver->table = table;
+    solver->table_mask = SOLVER_TABLE_SIZE(table_bits) - 1;
+    memset(table, 0, SOLVER_TABLE_BYTES(table_bits));
+    solver->depth = 0;
+    solver->next[0] = 0;
+    solver->nodes = 0;
+    solver->node_budget = node_budget;
+    solver->expanded = 0;
+    solver->branches = 0;
+    solver->dead_ends = 0;
+    solver->cut = false;
+    solver->result = SolverRunning;
+    solver->best_score = 0;
+    solver->best.type = MoveDraw;
+    solver->best.count = 0;
+    visit(solver);
+}
+
+static Move entry_move(const JournalEntry *entry) {
+    Move move = {MovePile, entry->from, entry->to, entry->count};
+    if (entry->flags & JournalFlip) move.type = MoveFlip;
+    else if (entry->flags & JournalExpose) move.type = MoveDraw;
+    else if (entry->flags & JournalTurnOver) move.type = MoveRecycle;
+    return move;
+}
+
+//two points per card on the foundations, one per card turned face up in the tableau
+static uint8_t position_score(const Board *board) {
+    uint8_t hidden = board->hidden_total - board_hidden(board, PileDeck) - board_hidden(board, PileWaste);
+    return board_on_foundation(board) * 2 + (CARD_COUNT - hidden);
+}
+
+SolverResult solver_run(Solver *solver, uint32_t nodes) {
+    while (solver->result == SolverRunning && nodes--) {
+        if (klondike_is_won(&solver->game)) {
+            solver->result = SolverSolved;
+            if (solver->depth) solver->best = entry_move(&(solver->path[0]));
+            break;
+        }
+        if (solver->nodes >= solver->node_budget) {
+            solver->result = SolverGaveUp;
+            break;
+        }
+
+        uint8_t count = order_moves(solver);
+        uint16_t depth = solver->depth;
+        if (solver->next[depth] == 0) {
+            solver->expanded++;
+            solver->branches += count;
+        }
+        if (depth + STOCK_MOVE_MAX > SOLVER_MAX_DEPTH && count) {
+            solver->cut = true;
+        } else if (solver->next[depth] < count) {
+            play(solver, &solver->moves[solver->next[depth]++]);
+            solver->nodes++;
+            if (visit(solver)) {
+                solver->next[solver->depth] = 0;
+                uint8_t score = position_score(&solver->game.board);
+                if (score > solver->best_score) {
+                    solver->best_score = score;
+                    solver->best = entry_move(&(solver->path[0]));
+                }
+            } else {
+                take_back(solver);
+            }
+            continue;
+        }
+
+        //every move of this position was tried
+        solver->dead_ends++;
+        if (depth == 0) {
+            solver->result = solver->cut ? SolverGaveUp : SolverUnsolvable;
+            break;
+        }
+        take_back(solver);
+    }
+    return solver->result;
+}
+
+uint16_t solver_solution(const Solver *solver, Move *moves) {
+    for (uint16_t i = 0; i < solver->depth; i++) moves[i] = entry_move(&(solver->path[i]));
+    return solver->depth;
+}
+
+bool solver_verify(const Klondike *game, const Move *moves, uint16_t count) {
+    Klondike replay = *game;
+    for (uint16_t i = 0; i < count; i++) {
+        if (!klondike_is_legal(&replay, &moves[i])) return false;
+        klondike_apply_move(&replay, &moves[i]);
+    }
+    return klondike_is_won(&replay);
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "klondike.h"
+
+//Depth first Klondike solver that can be run a few nodes at a time, no furi dependencies
+//Visited positions go into a transposition table owned by the caller, 4 bytes per entry
+
+//longest move sequence the solver follows, deeper lines are cut and the result is no longer a proof
+#define SOLVER_MAX_DEPTH 512
+
+#define SOLVER_TABLE_SIZE(bits) (1UL << (bits))
+#define SOLVER_TABLE_BYTES(bits) (SOLVER_TABLE_SIZE(bits) * sizeof(uint32_t))
+
+typedef enum {
+    SolverRunning,
+    //the path holds a winning move sequence
+    SolverSolved,
+    //every reachable position was searched, the deal can't be won
+    SolverUnsolvable,
+    //the node budget ran out, or some lines went deeper than SOLVER_MAX_DEPTH
+    SolverGaveUp,
+} SolverResult;
+
+typedef struct {
+    Klondike game;
+    uint64_t hash;
+    uint32_t *table;
+    uint32_t table_mask;
+    JournalEntry path[SOLVER_MAX_DEPTH];
+    //the next move to try at each depth, moves are generated again in the same order when the search returns
+    uint8_t next[SOLVER_MAX_DEPTH + 1];
+    Move moves[KLONDIKE_MAX_MOVES];
+    uint16_t depth;
+    uint32_t nodes;
+    uint32_t node_budget;
+    //positions whose moves were generated, the moves they had, and how many of them lead nowhere after every move
+    //was tried
+    uint32_t expanded;
+    uint32_t branches;
+    uint32_t dead_ends;
+    bool cut;
+    SolverResult result;
+    //first move of the most promising line so far, by cards on the foundations and face up in the tableau
+    //best_score stays 0 until a move was tried
+    Move best;
+    uint8_t best_score;
+} Solver;
+
+//starts a search from the current position of game, table needs SOLVER_TABLE_BYTES(table_bits)
+void solver_start(Solver *solver, const Klondike *game, uint32_t *table, uint8_t table_bits, uint32_t node_budget);
+
+//searches up to nodes more positions, callers split the work into slices to stay within a time budget
+SolverResult solver_run(Solver *solver, uint32_t nodes);
+
+//Zobrist key of a position, the same one the search uses
+uint64_t solver_position_key(const Board *board);
+
+//the moves of the solution (or the current line while running), returns how many there are
+uint16_t solver_solution(const Solver *solver, Move *moves);
+
+//replays moves from game, true if every move is legal and the game ends up won
+bool solver_verify(const Klondike *game, const Move *moves, uint16_t count);
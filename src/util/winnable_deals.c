@@ -0,0 +1,30 @@
+#include "winnable_deals.h"
+#include "klondike.h"
+
+DealDifficulty winnable_difficulty(uint32_t seed) {
+    if (seed >= winnable_table_seeds) return DealUnknown;
+    return (DealDifficulty) ((winnable_table[seed / 4] >> ((seed % 4) * 2)) & 3);
+}
+
+uint32_t winnable_pick(uint32_t random) {
+    uint32_t seed = random % winnable_table_seeds;
+    for (uint32_t i = 0; i < winnable_table_seeds; i++) {
+        if (winnable_difficulty(seed) != DealUnknown) return seed;
+        seed = (seed + 1) % winnable_table_seeds;
+    }
+    return seed;
+}
+
+//days since 1970-01-01, years start in March so the leap day is the last day of its year
+static uint32_t day_number(uint16_t year, uint8_t month, uint8_t day) {
+    uint32_t y = year - (month <= 2);
+    uint32_t era = y / 400, year_of_era = y % 400;
+    uint32_t day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    return era * 146097 + year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year - 719468;
+}
+
+uint32_t winnable_daily(uint16_t year, uint8_t month, uint8_t day) {
+    //neighbouring days get unrelated picks
+    uint32_t state = day_number(year, month, day);
+    return winnable_pick(klondike_random(&state));
+}
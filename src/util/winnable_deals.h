@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//Seeds the solver has proven winnable, so a winnable game is dealt without any search on the device
+//The table is generated by tools/deal_analyzer, it holds 2 bits per seed starting at seed 0, four seeds per byte
+//with the lowest seed in the low bits
+
+typedef enum {
+    DealUnknown,
+    DealEasy,
+    DealMedium,
+    DealHard,
+} DealDifficulty;
+
+extern const uint32_t winnable_table_seeds;
+extern const uint8_t winnable_table[];
+
+//DealUnknown for seeds without a known solution and seeds outside the table
+DealDifficulty winnable_difficulty(uint32_t seed);
+
+//the first winnable seed at or after random % winnable_table_seeds, wrapping around
+uint32_t winnable_pick(uint32_t random);
+
+//the winnable seed of a calendar day, every device picks the same one for the same date
+uint32_t winnable_daily(uint16_t year, uint8_t month, uint8_t day);
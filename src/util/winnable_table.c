@@ -0,0 +1,135 @@
+//Generated with tools/deal_analyzer -n 8192 -b 100000 -T 18 -C src/util/winnable_table.c, do not edit
+#include "winnable_deals.h"
+
+const uint32_t winnable_table_seeds = 8192;
+
+const uint8_t winnable_table[] = {
+    0x60, 0x60, 0x0a, 0x45, 0x54, 0x01, 0x94, 0x40, 0x15, 0x61, 0x4f, 0x44, 0xb0, 0x14, 0x52, 0x57,
+    0xa4, 0xc0, 0x0d, 0x43, 0x04, 0xc2, 0x74, 0x01, 0x90, 0x04, 0x25, 0x64, 0x80, 0x80, 0x0d, 0x90,
+    0x25, 0xc0, 0x80, 0x50, 0x08, 0x45, 0x28, 0x54, 0x40, 0x15, 0x42, 0x51, 0x14, 0x5e, 0x14, 0xf1,
+    0x11, 0x50, 0x60, 0x14, 0x44, 0x54, 0x41, 0x1d, 0x44, 0x02, 0x07, 0x14, 0x00, 0x83, 0x20, 0x11,
+    0x15, 0xc5, 0x40, 0x15, 0xd1, 0x46, 0x16, 0x03, 0x15, 0x46, 0x95, 0x11, 0xc4, 0x43, 0x00, 0x60,
+    0x45, 0x0c, 0x17, 0x11, 0x01, 0x10, 0x48, 0x44, 0x04, 0x3e, 0x57, 0x91, 0x15, 0xf0, 0x49, 0x01,
+    0x40, 0x1d, 0x54, 0x13, 0xd4, 0x56, 0xc4, 0x63, 0x55, 0x5e, 0x25, 0x44, 0x19, 0x5d, 0x54, 0x80,
+    0x7c, 0x03, 0x50, 0x80, 0x57, 0x11, 0x00, 0x52, 0x45, 0x41, 0x42, 0x00, 0x45, 0x10, 0x56, 0x1c,
+    0x15, 0x00, 0x56, 0x35, 0x30, 0x0d, 0x45, 0x10, 0x41, 0x4a, 0x04, 0x05, 0x30, 0x74, 0x98, 0x05,
+    0x05, 0x54, 0x32, 0x45, 0x01, 0x40, 0x48, 0x14, 0x58, 0x59, 0x05, 0x00, 0x50, 0x84, 0x14, 0x04,
+    0x41, 0xb5, 0x58, 0x45, 0x1d, 0x39, 0x01, 0x57, 0x54, 0x14, 0x18, 0x38, 0x55, 0x0d, 0x00, 0x04,
+    0x10, 0x54, 0x66, 0x04, 0x41, 0x11, 0x44, 0x50, 0x40, 0x54, 0xe0, 0x07, 0x10, 0x5c, 0x50, 0x45,
+    0x00, 0x50, 0x21, 0x55, 0x14, 0x54, 0x15, 0x42, 0x14, 0x35, 0x02, 0x55, 0x15, 0x5a, 0x01, 0x15,
+    0x57, 0x0c, 0x50, 0x17, 0x5c, 0x40, 0x70, 0x82, 0x54, 0x40, 0x53, 0x08, 0x00, 0x44, 0x54, 0x64,
+    0x85, 0x55, 0x41, 0x45, 0x2c, 0x56, 0x52, 0x54, 0x84, 0x11, 0x11, 0x00, 0x61, 0xd5, 0x08, 0x81,
+    0x01, 0x0a, 0x5d, 0xd4, 0x41, 0xc5, 0x10, 0x05, 0x04, 0x44, 0x4c, 0x64, 0x05, 0x01, 0x48, 0x90,
+    0x55, 0x40, 0x10, 0x55, 0x83, 0x05, 0x55, 0x90, 0x1d, 0x50, 0x10, 0x70, 0x05, 0x97, 0x16, 0x7c,
+    0x45, 0x0d, 0x52, 0xc9, 0x55, 0x15, 0x10, 0x55, 0x01, 0xa0, 0x44, 0x05, 0xc2, 0x51, 0x93, 0x84,
+    0x19, 0x24, 0x80, 0x0d, 0x0d, 0x1e, 0x07, 0x6d, 0x28, 0x11, 0x02, 0x06, 0x00, 0x14, 0x04, 0x13,
+    0x4b, 0x20, 0x51, 0x28, 0x80, 0x40, 0x14, 0x55, 0x44, 0x49, 0x00, 0x50, 0x15, 0x54, 0x45, 0x05,
+    0x00, 0x45, 0x41, 0x21, 0x54, 0x40, 0x55, 0x45, 0x00, 0x50, 0x12, 0x39, 0x59, 0x00, 0x55, 0x81,
+    0x05, 0x79, 0x90, 0x01, 0x50, 0x5c, 0x51, 0x46, 0x44, 0x55, 0x42, 0x05, 0x0c, 0x10, 0x42, 0x07,
+    0x21, 0x81, 0x24, 0x18, 0x47, 0x52, 0x24, 0x10, 0x25, 0x84, 0x10, 0x06, 0x40, 0x04, 0xc5, 0x50,
+    0x25, 0x09, 0x54, 0x11, 0x15, 0x68, 0x10, 0xd5, 0x91, 0xd7, 0x0c, 0x45, 0x74, 0x05, 0x55, 0x55,
+    0x11, 0x89, 0x41, 0x10, 0x42, 0xd5, 0x01, 0x11, 0x04, 0x62, 0x08, 0x43, 0x40, 0x82, 0x14, 0xc0,
+    0xf1, 0x85, 0x05, 0x10, 0x54, 0x14, 0x52, 0x70, 0x51, 0x05, 0x50, 0x11, 0x00, 0x05, 0x10, 0x6b,
+    0x04, 0xf1, 0xc5, 0x40, 0xfc, 0x09, 0xa1, 0x54, 0x11, 0x44, 0x90, 0x11, 0xe9, 0x19, 0x15, 0xd5,
+    0x00, 0x25, 0x50, 0x54, 0x55, 0x00, 0x0f, 0x04, 0x44, 0x54, 0x23, 0x7c, 0x00, 0xa0, 0x44, 0x55,
+    0x84, 0x0e, 0x00, 0x07, 0x04, 0x95, 0x7c, 0x54, 0x46, 0x00, 0x04, 0x18, 0xc0, 0x40, 0x55, 0x44,
+    0x45, 0x73, 0x53, 0x65, 0x55, 0x47, 0x05, 0x40, 0x04, 0x11, 0x65, 0x51, 0xec, 0x26, 0x12, 0x95,
+    0x86, 0x55, 0x65, 0x45, 0x51, 0x14, 0x5d, 0x40, 0x10, 0x04, 0x00, 0x41, 0x11, 0x00, 0x05, 0x15,
+    0x02, 0x34, 0x53, 0x40, 0x13, 0xd4, 0x10, 0x51, 0x45, 0x47, 0x03, 0x75, 0x10, 0x51, 0x04, 0x41,
+    0xd4, 0x5c, 0x20, 0x10, 0x1c, 0x56, 0xa2, 0x00, 0x55, 0x74, 0x55, 0x89, 0x35, 0x4d, 0x41, 0x54,
+    0x51, 0x91, 0x00, 0x16, 0x11, 0x72, 0x16, 0x12, 0x14, 0x45, 0x15, 0x14, 0x98, 0x7b, 0x0d, 0x55,
+    0x25, 0x84, 0x06, 0x84, 0x14, 0x00, 0x24, 0x45, 0xc4, 0x05, 0x65, 0x17, 0x54, 0x11, 0x84, 0x11,
+    0xb4, 0x90, 0x5d, 0x00, 0xc1, 0xc0, 0x41, 0x10, 0x54, 0x0d, 0x51, 0x82, 0x5d, 0x15, 0x79, 0x09,
+    0x04, 0xe2, 0xc8, 0x46, 0xd5, 0x49, 0x21, 0x99, 0x54, 0x80, 0x11, 0x15, 0x44, 0x90, 0x41, 0x12,
+    0x1d, 0x04, 0x01, 0x50, 0x91, 0x91, 0x4a, 0x5c, 0x50, 0x51, 0x79, 0x50, 0x1b, 0x0d, 0xd0, 0x41,
+    0x15, 0x44, 0x54, 0xc0, 0x88, 0x69, 0x47, 0xca, 0x18, 0x49, 0x08, 0x25, 0xd1, 0x4a, 0x08, 0x09,
+    0x10, 0x00, 0x01, 0x91, 0x54, 0x20, 0x05, 0x39, 0x5d, 0x82, 0xd3, 0x04, 0x81, 0x10, 0x44, 0x05,
+    0x18, 0x45, 0x05, 0x06, 0x50, 0xd8, 0x65, 0x44, 0x51, 0x56, 0x42, 0x10, 0x71, 0x75, 0x45, 0x90,
+    0x51, 0x48, 0x21, 0x11, 0x44, 0x11, 0x50, 0x28, 0x72, 0xd6, 0xd8, 0x04, 0x00, 0x64, 0x94, 0xd1,
+    0x11, 0x05, 0x48, 0x59, 0x45, 0x44, 0x14, 0x25, 0x99, 0x80, 0x14, 0x40, 0x40, 0x53, 0xc4, 0x60,
+    0x29, 0x75, 0x41, 0x60, 0x00, 0x01, 0x47, 0x00, 0x51, 0x49, 0x51, 0x4b, 0x55, 0x91, 0x04, 0x41,
+    0x58, 0x51, 0x10, 0x00, 0x55, 0x19, 0xdc, 0x44, 0x44, 0x05, 0x9b, 0x80, 0x53, 0x80, 0x60, 0x08,
+    0x10, 0xc5, 0x44, 0xb4, 0xb6, 0x10, 0x1c, 0x20, 0x50, 0x62, 0x60, 0x6a, 0xb0, 0x28, 0x08, 0x40,
+    0x81, 0x54, 0x59, 0x04, 0x44, 0x10, 0x04, 0x21, 0x0a, 0x01, 0x70, 0xb5, 0x15, 0x44, 0x19, 0x24,
+    0x05, 0x41, 0x54, 0x95, 0x04, 0x01, 0x45, 0x4d, 0x54, 0x95, 0x40, 0x51, 0xc6, 0x51, 0x41, 0x03,
+    0x55, 0x47, 0x12, 0x66, 0x58, 0x00, 0x92, 0xa5, 0x1d, 0x17, 0x03, 0x00, 0x04, 0x00, 0x12, 0x50,
+    0x41, 0x95, 0x38, 0x50, 0x55, 0x4c, 0xcb, 0x16, 0xdc, 0x05, 0x00, 0x11, 0x11, 0x34, 0x99, 0x55,
+    0x41, 0x00, 0x00, 0x5d, 0x20, 0x90, 0xd8, 0x04, 0xe5, 0x5d, 0x0c, 0x54, 0x5c, 0x12, 0x4e, 0xc8,
+    0x35, 0x51, 0x84, 0x91, 0x00, 0x89, 0x59, 0x4c, 0xc3, 0x84, 0x50, 0x4c, 0x73, 0x40, 0xc5, 0x55,
+    0x14, 0x71, 0x88, 0x04, 0x30, 0x44, 0x00, 0x55, 0x41, 0x71, 0x80, 0x45, 0x01, 0x47, 0xcf, 0x38,
+    0x26, 0x85, 0xb5, 0x51, 0x15, 0x15, 0x97, 0x17, 0x44, 0x44, 0xab, 0xb4, 0x07, 0x89, 0x65, 0x90,
+    0x41, 0x1a, 0x01, 0x15, 0xc2, 0x51, 0x44, 0x00, 0x09, 0x54, 0x31, 0x4d, 0xd0, 0x5f, 0x10, 0x71,
+    0xd4, 0x00, 0x43, 0x82, 0x54, 0x03, 0x44, 0x49, 0x50, 0x0c, 0x84, 0x44, 0x45, 0x04, 0x44, 0x00,
+    0x60, 0x36, 0x91, 0x22, 0x58, 0x46, 0xc0, 0x70, 0x20, 0x30, 0x56, 0x40, 0xd1, 0x1e, 0x50, 0x1c,
+    0xa0, 0x03, 0x18, 0x5d, 0x14, 0x54, 0x19, 0x45, 0x84, 0xdd, 0x6d, 0x65, 0x1c, 0x47, 0x00, 0x00,
+    0x65, 0x91, 0x44, 0x03, 0x08, 0x51, 0x04, 0x54, 0x54, 0x40, 0x20, 0x11, 0x15, 0x04, 0x35, 0x40,
+    0x11, 0x45, 0x94, 0x0d, 0x56, 0x71, 0xdd, 0x08, 0x01, 0x5a, 0xd7, 0x44, 0x98, 0x51, 0x01, 0x52,
+    0x06, 0x30, 0x19, 0xd0, 0x80, 0x10, 0x07, 0x53, 0x54, 0x11, 0x85, 0x31, 0x54, 0x70, 0x53, 0x51,
+    0x41, 0x50, 0x41, 0x60, 0x14, 0x55, 0x44, 0x29, 0x44, 0x40, 0xc1, 0x50, 0x05, 0x55, 0x88, 0x14,
+    0xa1, 0x20, 0x55, 0x50, 0x04, 0xc2, 0xc4, 0x49, 0x40, 0x10, 0x1c, 0x75, 0x14, 0x04, 0x0d, 0x50,
+    0x91, 0x53, 0x50, 0xe5, 0x27, 0x55, 0x65, 0x42, 0x40, 0xfd, 0x19, 0x46, 0x59, 0x84, 0xc1, 0xd5,
+    0x04, 0x54, 0x01, 0xe5, 0x85, 0x75, 0x05, 0xc1, 0x84, 0x45, 0x44, 0x45, 0x41, 0x41, 0x5f, 0x19,
+    0x18, 0x10, 0x60, 0x48, 0x75, 0x74, 0x40, 0x53, 0x04, 0x11, 0x00, 0x51, 0x15, 0x20, 0x01, 0x59,
+    0x01, 0x14, 0x03, 0x04, 0x14, 0x10, 0x91, 0x54, 0x1d, 0x45, 0x84, 0x01, 0x44, 0x07, 0x51, 0x11,
+    0x90, 0xd3, 0x10, 0x15, 0x88, 0xc1, 0x7f, 0x10, 0x05, 0x25, 0x01, 0x25, 0xc6, 0x67, 0x06, 0x00,
+    0x50, 0x94, 0x15, 0x01, 0x11, 0x04, 0x25, 0x54, 0xe7, 0x11, 0x42, 0x54, 0x74, 0x0a, 0x05, 0x57,
+    0x0c, 0x25, 0x0d, 0x14, 0x95, 0x59, 0x55, 0x00, 0x38, 0x35, 0x7f, 0x15, 0x44, 0x54, 0x44, 0x04,
+    0x00, 0x71, 0x10, 0x00, 0x54, 0x15, 0x03, 0x1d, 0x14, 0x11, 0xd1, 0x44, 0x82, 0x41, 0x84, 0x05,
+    0x15, 0xc1, 0x18, 0x31, 0x14, 0x54, 0x05, 0x89, 0x95, 0x41, 0x37, 0x41, 0x50, 0x55, 0x0b, 0x74,
+    0x00, 0x09, 0x10, 0x10, 0x01, 0x44, 0x19, 0x58, 0x15, 0x00, 0x00, 0x20, 0x70, 0x91, 0x4f, 0x05,
+    0x61, 0x44, 0xc0, 0x76, 0x41, 0x11, 0x61, 0x0d, 0x32, 0x5a, 0x44, 0x99, 0x26, 0xf6, 0x00, 0x88,
+    0x19, 0x74, 0x40, 0x13, 0xd4, 0x5c, 0x44, 0x10, 0x11, 0x0a, 0x05, 0x34, 0x44, 0x84, 0x41, 0xb3,
+    0x04, 0x91, 0x40, 0x00, 0x45, 0x90, 0x43, 0x55, 0x01, 0x1e, 0x01, 0x41, 0x54, 0x45, 0x01, 0x50,
+    0x04, 0x54, 0x74, 0x86, 0xd4, 0x41, 0x44, 0x01, 0xc4, 0x04, 0x90, 0x42, 0x10, 0x11, 0x51, 0x54,
+    0x42, 0x56, 0x17, 0x40, 0x64, 0x50, 0x1e, 0xd2, 0x57, 0x40, 0x40, 0x24, 0x59, 0x05, 0x18, 0xd1,
+    0x14, 0x55, 0x60, 0x20, 0x14, 0x41, 0x54, 0x51, 0x10, 0x00, 0x16, 0x90, 0x45, 0x75, 0x64, 0x55,
+    0x43, 0x85, 0x15, 0x51, 0x15, 0x51, 0x1c, 0x04, 0x6c, 0x44, 0x9c, 0x45, 0x50, 0x49, 0x48, 0x16,
+    0x04, 0x65, 0x30, 0x71, 0x04, 0x54, 0x4d, 0x05, 0x81, 0x51, 0x01, 0x11, 0x44, 0x44, 0x4b, 0xad,
+    0xb5, 0x11, 0x41, 0x00, 0x50, 0x45, 0x85, 0x83, 0x14, 0x27, 0x12, 0x41, 0x16, 0x00, 0x16, 0xb4,
+    0xc1, 0x91, 0x04, 0x49, 0x57, 0x14, 0x09, 0x01, 0x33, 0x05, 0x45, 0x07, 0x00, 0x64, 0x19, 0x32,
+    0x35, 0x41, 0x51, 0x50, 0x10, 0x64, 0x35, 0x25, 0xc4, 0x34, 0x89, 0x01, 0x51, 0xe4, 0x09, 0x30,
+    0x01, 0x02, 0x11, 0x02, 0x43, 0x53, 0x65, 0x54, 0x04, 0x4d, 0x55, 0x50, 0x90, 0x03, 0xc8, 0x57,
+    0x50, 0x00, 0x11, 0x0b, 0x04, 0x10, 0x40, 0x54, 0x54, 0x55, 0x15, 0x01, 0x45, 0x33, 0x40, 0x01,
+    0x14, 0x05, 0x4d, 0x11, 0x10, 0x10, 0x24, 0x61, 0x1d, 0x00, 0x52, 0x14, 0x51, 0x11, 0x84, 0x44,
+    0x42, 0x45, 0x42, 0x56, 0x59, 0x11, 0x15, 0x25, 0x11, 0x32, 0x51, 0xa6, 0x03, 0x05, 0x19, 0x1d,
+    0x11, 0x5a, 0x73, 0x16, 0x04, 0x44, 0x25, 0x88, 0xf5, 0x51, 0x57, 0x61, 0x45, 0x44, 0xa8, 0x19,
+    0x44, 0x54, 0x04, 0x10, 0x44, 0x53, 0x58, 0x11, 0x05, 0xc4, 0xd4, 0x54, 0x10, 0x51, 0x11, 0x54,
+    0x50, 0x07, 0x64, 0x1d, 0x57, 0x90, 0x54, 0x81, 0x42, 0x0d, 0x0c, 0x51, 0x35, 0xc5, 0x75, 0xd0,
+    0x40, 0xd0, 0xc4, 0x35, 0x57, 0x52, 0x08, 0x12, 0x38, 0x55, 0x0c, 0x55, 0x20, 0x4c, 0x41, 0x55,
+    0xd0, 0x81, 0x10, 0x44, 0x07, 0xd1, 0x10, 0x43, 0x10, 0x54, 0x01, 0x44, 0x95, 0x65, 0x75, 0x14,
+    0x10, 0x61, 0x06, 0x56, 0x72, 0x91, 0x5d, 0xa0, 0x15, 0x5c, 0x42, 0x54, 0x05, 0x55, 0x64, 0x84,
+    0x16, 0x00, 0xf1, 0x11, 0x90, 0x08, 0x19, 0x91, 0x5d, 0x80, 0x45, 0x14, 0x74, 0x15, 0x55, 0x4d,
+    0x15, 0x44, 0x50, 0x19, 0x40, 0x01, 0x47, 0x00, 0xf4, 0x59, 0x25, 0x98, 0x70, 0x08, 0x30, 0x17,
+    0x06, 0x25, 0x05, 0x1d, 0x04, 0x04, 0x41, 0x04, 0x04, 0x45, 0xd0, 0x41, 0x54, 0x4c, 0x04, 0x99,
+    0x0c, 0x16, 0x45, 0x59, 0x54, 0x05, 0x01, 0x5d, 0x17, 0x67, 0xb1, 0x61, 0x0c, 0x08, 0x46, 0x40,
+    0x11, 0x55, 0x4d, 0x51, 0x08, 0xd5, 0xb0, 0x04, 0x10, 0x7a, 0x41, 0xd4, 0x52, 0x95, 0x59, 0x40,
+    0x05, 0x76, 0x99, 0x52, 0x19, 0x14, 0x04, 0x35, 0x54, 0x08, 0x75, 0x15, 0x04, 0x09, 0xf9, 0x05,
+    0x00, 0x00, 0x14, 0x44, 0x46, 0x48, 0x00, 0x40, 0x1b, 0x19, 0x44, 0x01, 0x71, 0x54, 0x88, 0x70,
+    0x75, 0x54, 0x09, 0x50, 0x91, 0x06, 0x55, 0x1c, 0x00, 0x00, 0x07, 0x93, 0x50, 0x5d, 0x44, 0x00,
+    0x54, 0xc5, 0x15, 0x40, 0x12, 0x00, 0x02, 0xb5, 0x25, 0x64, 0x04, 0xc1, 0x0a, 0xa8, 0x44, 0x14,
+    0x50, 0x4d, 0x10, 0x44, 0x54, 0xc4, 0x72, 0x50, 0x00, 0x51, 0x61, 0x05, 0x81, 0x53, 0x94, 0x94,
+    0x00, 0x15, 0x26, 0x41, 0xc5, 0x65, 0x73, 0x05, 0x18, 0x14, 0x84, 0x34, 0x01, 0x0f, 0x14, 0x84,
+    0x55, 0x04, 0x91, 0x12, 0x08, 0x61, 0x54, 0x24, 0x10, 0x2a, 0x57, 0x59, 0x14, 0xc0, 0x95, 0xc4,
+    0x41, 0x51, 0x0c, 0x76, 0x04, 0xf5, 0x65, 0x25, 0x41, 0x55, 0x16, 0x5c, 0x01, 0x51, 0x58, 0xcd,
+    0xc1, 0x49, 0x81, 0x54, 0x70, 0x74, 0x08, 0x48, 0x69, 0x05, 0x94, 0x3d, 0x5c, 0x40, 0x71, 0xdd,
+    0x13, 0x9e, 0xc4, 0x90, 0x20, 0x41, 0x41, 0x53, 0x00, 0x64, 0x19, 0x0a, 0x44, 0x11, 0x5d, 0x25,
+    0x50, 0x54, 0x55, 0x42, 0x55, 0x05, 0x10, 0x11, 0x5d, 0x12, 0x49, 0x4d, 0x6c, 0x00, 0x15, 0x10,
+    0x60, 0x38, 0x8c, 0x60, 0x14, 0x90, 0x51, 0x50, 0x44, 0x15, 0x54, 0x04, 0x52, 0x51, 0x00, 0x34,
+    0xd4, 0x10, 0x31, 0xb0, 0x6d, 0xc5, 0xc4, 0x11, 0x35, 0x57, 0x4c, 0x41, 0x14, 0x90, 0x5b, 0x00,
+    0x00, 0x4a, 0x54, 0x53, 0x15, 0x91, 0x50, 0x00, 0x57, 0x08, 0x1d, 0x70, 0xd8, 0x18, 0x56, 0x01,
+    0x13, 0x41, 0x70, 0x15, 0x69, 0x40, 0x60, 0x41, 0x51, 0x43, 0x65, 0x52, 0x51, 0x78, 0x50, 0x59,
+    0x47, 0x71, 0x10, 0x51, 0x54, 0x6c, 0x10, 0x20, 0x35, 0x00, 0x44, 0x14, 0xc0, 0x65, 0x04, 0x40,
+    0x04, 0x10, 0x09, 0x11, 0x54, 0x00, 0x49, 0x31, 0x54, 0x50, 0x05, 0xf4, 0x41, 0x9e, 0x34, 0x56,
+    0x44, 0xd0, 0x00, 0x51, 0x41, 0x20, 0x05, 0x64, 0x99, 0x10, 0xb4, 0x03, 0x80, 0x45, 0x54, 0x20,
+    0x02, 0x01, 0x00, 0x39, 0x65, 0xc6, 0xcc, 0x72, 0x31, 0x00, 0x20, 0xf6, 0xc4, 0x04, 0x91, 0x56,
+    0x56, 0x61, 0x14, 0xe0, 0x01, 0x11, 0x52, 0x43, 0xd2, 0xf1, 0xc4, 0x05, 0x5a, 0x17, 0x59, 0x36,
+    0x49, 0x24, 0x05, 0xc0, 0x5b, 0x17, 0x18, 0x06, 0x45, 0x03, 0x48, 0x61, 0xc8, 0x45, 0x69, 0x11,
+    0x75, 0x82, 0x82, 0x54, 0x50, 0x51, 0x15, 0x14, 0x01, 0x05, 0x59, 0x59, 0x15, 0x01, 0x14, 0x75,
+    0x04, 0x40, 0x70, 0x50, 0xd0, 0x22, 0x50, 0x04, 0x18, 0x06, 0x10, 0x14, 0x45, 0x55, 0x45, 0x21,
+    0x45, 0x44, 0x18, 0x47, 0x74, 0x04, 0x50, 0x14, 0x12, 0x54, 0x57, 0xad, 0x11, 0x4c, 0x6c, 0x30,
+    0x60, 0xd4, 0x40, 0x65, 0xc5, 0x40, 0x91, 0x44, 0x44, 0x00, 0x01, 0x00, 0x11, 0x74, 0x55, 0x46,
+    0x65, 0x61, 0x5d, 0x92, 0x04, 0x11, 0x48, 0xcd, 0x43, 0x15, 0x68, 0x4d, 0x65, 0x55, 0x55, 0x11,
+    0x44, 0x53, 0x05, 0x00, 0x45, 0x20, 0xd4, 0x08, 0x00, 0xd1, 0x10, 0x51, 0x30, 0x09, 0x54, 0x11,
+    0x22, 0x45, 0x93, 0x11, 0x74, 0x01, 0x11, 0xc0, 0x45, 0x54, 0x24, 0x45, 0x53, 0x21, 0x01, 0x44,
+    0x17, 0x19, 0x05, 0x64, 0x12, 0x00, 0x40, 0xc5, 0x48, 0x5c, 0x41, 0x21, 0x05, 0x70, 0x51, 0x1e,
+};
@@ -0,0 +1,291 @@
+//Replays the same random games on the byte board and on the List of heap Cards the piles used to be, reports moves
+//per second and heap use of both
+//cc -O2 -o board_bench tools/board_bench.c src/util/klondike.c src/util/board.c src/util/journal.c src/util/rules.c
+//   && ./board_bench [games] [rounds]
+//the List side is the one of the original app, copied here since the game no longer has it. A pile move goes through
+//the hand one card at a time like it used to, every list node and card is a heap allocation
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../src/util/klondike.h"
+
+//moves per game before it is given up, random play rarely finishes
+#define PLAYOUT_LENGTH 400
+
+typedef struct ListItem {
+    void *data;
+    struct ListItem *next;
+    struct ListItem *prev;
+} ListItem;
+
+typedef struct {
+    ListItem *head;
+    ListItem *tail;
+    size_t count;
+} List;
+
+typedef struct {
+    uint8_t suit;
+    CardValue value;
+    bool exposed;
+} HeapCard;
+
+typedef struct {
+    List *piles[PileCount];
+    List *hand;
+} ListGame;
+
+//live and peak heap of the List side, every allocation is a node, a card or a list
+static uint32_t allocations = 0;
+static size_t heap_live = 0;
+static size_t heap_peak = 0;
+
+static void *counted_malloc(size_t size) {
+    allocations++;
+    heap_live += size;
+    if (heap_live > heap_peak) heap_peak = heap_live;
+    return malloc(size);
+}
+
+static void counted_free(void *data, size_t size) {
+    heap_live -= size;
+    free(data);
+}
+
+static List *list_make() {
+    List *list = counted_malloc(sizeof(List));
+    list->head = NULL;
+    list->tail = NULL;
+    list->count = 0;
+    return list;
+}
+
+static void list_push_back(void *data, List *list) {
+    ListItem *newItem = counted_malloc(sizeof(ListItem));
+    newItem->data = data;
+    newItem->next = NULL;
+    newItem->prev = list->tail;
+    if (list->tail == NULL) {
+        list->head = newItem;
+        list->tail = newItem;
+    } else {
+        list->tail->next = newItem;
+        list->tail = newItem;
+    }
+    list->count++;
+}
+
+static void list_push_front(void *data, List *list) {
+    ListItem *newItem = counted_malloc(sizeof(ListItem));
+    newItem->data = data;
+    newItem->next = list->head;
+    newItem->prev = NULL;
+    if (list->head == NULL) {
+        list->head = newItem;
+        list->tail = newItem;
+    } else {
+        list->head->prev = newItem;
+        list->head = newItem;
+    }
+    list->count++;
+}
+
+static void *list_pop_back(List *list) {
+    void *data = list->tail->data;
+    ListItem *prev = list->tail->prev;
+    if (prev) {
+        prev->next = NULL;
+    } else {
+        list->head = NULL;
+    }
+    counted_free(list->tail, sizeof(ListItem));
+    list->tail = prev;
+    list->count--;
+    return data;
+}
+
+static void *list_pop_front(List *list) {
+    void *data = list->head->data;
+    ListItem *next = list->head->next;
+    if (next) {
+        next->prev = NULL;
+    } else {
+        list->tail = NULL;
+    }
+    counted_free(list->head, sizeof(ListItem));
+    list->head = next;
+    list->count--;
+    return data;
+}
+
+static void list_free(List *list) {
+    while (list->count) counted_free(list_pop_back(list), sizeof(HeapCard));
+    counted_free(list, sizeof(List));
+}
+
+static void list_game_setup(ListGame *game, const Board *board) {
+    for (uint8_t pile = 0; pile < PileCount; pile++) {
+        game->piles[pile] = list_make();
+        for (uint8_t i = 0; i < board_count(board, pile); i++) {
+            Card card = board_peek_index(board, pile, i);
+            HeapCard *c = counted_malloc(sizeof(HeapCard));
+            c->suit = card_suit(card);
+            c->value = (CardValue) card_value(card);
+            c->exposed = card_is_exposed(card);
+            list_push_back(c, game->piles[pile]);
+        }
+    }
+    game->hand = list_make();
+}
+
+static void list_game_free(ListGame *game) {
+    for (uint8_t pile = 0; pile < PileCount; pile++) list_free(game->piles[pile]);
+    list_free(game->hand);
+}
+
+static void list_game_apply(ListGame *game, const Move *move) {
+    HeapCard *c;
+    switch (move->type) {
+        case MoveDraw:
+            c = list_pop_back(game->piles[PileDeck]);
+            c->exposed = true;
+            list_push_back(c, game->piles[PileWaste]);
+            break;
+        case MoveRecycle:
+            while (game->piles[PileWaste]->count) {
+                c = list_pop_back(game->piles[PileWaste]);
+                c->exposed = false;
+                list_push_back(c, game->piles[PileDeck]);
+            }
+            break;
+        case MoveFlip:
+            ((HeapCard *) game->piles[move->from]->tail->data)->exposed = true;
+            break;
+        default:
+            for (uint8_t i = 0; i < move->count; i++)
+                list_push_front(list_pop_back(game->piles[move->from]), game->hand);
+            for (uint8_t i = 0; i < move->count; i++)
+                list_push_back(list_pop_front(game->hand), game->piles[move->to]);
+            break;
+    }
+}
+
+//the same changes the journal makes, without recording them
+static void board_apply(Board *board, const Move *move) {
+    uint8_t count, first;
+    switch (move->type) {
+        case MoveDraw:
+            board_push(board, PileWaste, board_pop(board, PileDeck) | CARD_EXPOSED);
+            break;
+        case MoveRecycle:
+            count = board_count(board, PileWaste);
+            board_move(board, PileWaste, PileDeck, count);
+            board_reverse(board, PileDeck, count);
+            first = board_count(board, PileDeck) - count;
+            for (uint8_t i = 0; i < count; i++) board_set_exposed(board, PileDeck, first + i, false);
+            break;
+        case MoveFlip:
+            board_set_exposed(board, move->from, board_count(board, move->from) - 1, true);
+            break;
+        default:
+            board_move(board, move->from, move->to, move->count);
+            break;
+    }
+}
+
+static bool same_game(const ListGame *game, const Board *board) {
+    for (uint8_t pile = 0; pile < PileCount; pile++) {
+        if (game->piles[pile]->count != board_count(board, pile)) return false;
+        uint8_t i = 0;
+        for (ListItem *item = game->piles[pile]->head; item; item = item->next, i++) {
+            const HeapCard *c = item->data;
+            Card card = board_peek_index(board, pile, i);
+            if (c->suit != card_suit(card) || c->value != (CardValue) card_value(card) ||
+                c->exposed != card_is_exposed(card))
+                return false;
+        }
+    }
+    return true;
+}
+
+static double now() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv) {
+    uint32_t games = argc > 1 ? (uint32_t) atoi(argv[1]) : 200;
+    uint32_t rounds = argc > 2 ? (uint32_t) atoi(argv[2]) : 20;
+
+    Board *deals = malloc(games * sizeof(Board));
+    Move *moves = malloc(games * PLAYOUT_LENGTH * sizeof(Move));
+    uint16_t *lengths = malloc(games * sizeof(uint16_t));
+    Klondike *game = malloc(sizeof(Klondike));
+    if (!deals || !moves || !lengths || !game) return 1;
+
+    //record random playouts once, both sides replay the same moves
+    uint32_t rng = 1, total_moves = 0;
+    Move legal[KLONDIKE_MAX_MOVES];
+    for (uint32_t g = 0; g < games; g++) {
+        klondike_deal(game, g);
+        deals[g] = game->board;
+        lengths[g] = 0;
+        while (lengths[g] < PLAYOUT_LENGTH) {
+            uint8_t count = klondike_generate_moves(game, legal);
+            if (!count) break;
+            Move *move = &moves[g * PLAYOUT_LENGTH + lengths[g]++];
+            *move = legal[klondike_random(&rng) % count];
+            klondike_apply_move(game, move);
+        }
+        total_moves += lengths[g];
+    }
+
+    Board board;
+    double board_time = 0;
+    for (uint32_t r = 0; r < rounds; r++) {
+        for (uint32_t g = 0; g < games; g++) {
+            board = deals[g];
+            double start = now();
+            for (uint16_t i = 0; i < lengths[g]; i++) board_apply(&board, &moves[g * PLAYOUT_LENGTH + i]);
+            board_time += now() - start;
+        }
+    }
+
+    ListGame list;
+    double list_time = 0;
+    uint32_t move_allocations = 0, mismatches = 0;
+    for (uint32_t r = 0; r < rounds; r++) {
+        for (uint32_t g = 0; g < games; g++) {
+            list_game_setup(&list, &deals[g]);
+            uint32_t before = allocations;
+            double start = now();
+            for (uint16_t i = 0; i < lengths[g]; i++) list_game_apply(&list, &moves[g * PLAYOUT_LENGTH + i]);
+            list_time += now() - start;
+            move_allocations += allocations - before;
+
+            if (r == 0) {
+                board = deals[g];
+                for (uint16_t i = 0; i < lengths[g]; i++) board_apply(&board, &moves[g * PLAYOUT_LENGTH + i]);
+                if (!same_game(&list, &board)) mismatches++;
+            }
+            list_game_free(&list);
+        }
+    }
+
+    double replayed = (double) total_moves * rounds;
+    printf("%u games, %u moves, %u rounds\n", games, total_moves, rounds);
+    printf("board: %.1fM moves/s, %u bytes, no heap\n", replayed / board_time / 1e6, (uint32_t) sizeof(Board));
+    printf("list:  %.1fM moves/s, %u bytes peak heap, %.2f allocations per move\n", replayed / list_time / 1e6,
+           (uint32_t) heap_peak, move_allocations / replayed);
+    printf("list node %u bytes, card %u bytes on this host, plus the allocator header of each\n",
+           (uint32_t) sizeof(ListItem), (uint32_t) sizeof(HeapCard));
+    printf("%u games ended differently\n", mismatches);
+
+    free(game);
+    free(lengths);
+    free(moves);
+    free(deals);
+    return mismatches ? 1 : 0;
+}
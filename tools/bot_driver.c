@@ -0,0 +1,381 @@
+//Plays whole games without a device: a bot sends key events to the real scenes, the scene table and frame loop of
+//solitaire.c run them back to back and the board is checked after every frame
+//cc -O2 -Itools/host -o bot_driver tools/bot_driver.c tools/host/host.c assets.c src/scene/*.c src/util/*.c -lm
+//./bot_driver [-g games] [-b player|random] [-m random|winnable|daily] [-r] [-s seed] [-f frame limit]
+//
+//player follows solver lines with one key event per frame and resigns once the solver sees no win, a direction it
+//needs again is held down like on the device: Press, Long, then a Repeat every frame until it lets go
+//random mashes keys and resigns after a while
+//-m picks the deal mode on the title screen, -r skips rendering, -f gives up on a game after that many frames
+//frames are timed as 60 fps for the animations, so frames per game don't depend on the host
+//scene transitions are timed from the input or update that asked for them to the first frame of the new scene, like
+//the SCENE log of the device but without waiting for the next frame
+//deals are shuffled from the clock like on the device, -s only seeds the random bot
+//exits with 1 when an invariant broke or a game got stuck
+//built with -DALLOC_STATS every frame that touches the heap is reported, like on the device
+
+#include <unistd.h>
+#include "../solitaire.c"
+#include "../src/util/solver.h"
+
+#define SOLVER_BITS 18
+#define SOLVER_BUDGET 100000
+//random play frames before the random bot resigns
+#define RANDOM_PATIENCE 3000
+//moves the player bot makes before it resigns, solver lines never get this long
+#define PLAYER_PATIENCE 1000
+#define REPORTED_VIOLATIONS 10
+
+typedef enum {
+    BotPlayer,
+    BotRandom,
+} BotType;
+
+typedef struct {
+    BotType type;
+    DealMode mode;
+    uint32_t rng;
+
+    Solver *solver;
+    uint32_t *table;
+    Move plan[SOLVER_MAX_DEPTH];
+    uint16_t plan_count;
+    uint16_t plan_at;
+    uint16_t moves;
+    uint16_t quick_at;
+    uint32_t play_frames;
+    InputKey held;
+    bool held_long;
+
+    uint32_t presses;
+    uint32_t repeats;
+    uint32_t resigned;
+    uint32_t replans;
+} Bot;
+
+static uint32_t violations = 0;
+
+typedef struct {
+    uint32_t count;
+    uint64_t total;
+    uint32_t worst;
+} Latency;
+
+static Latency latency[SceneCount][SceneCount];
+
+static void violation(uint32_t game, uint64_t frame, const char *what) {
+    if (violations++ < REPORTED_VIOLATIONS)
+        fprintf(stderr, "game %u frame %llu (%s): %s\n", game, (unsigned long long) frame, scenes[current_scene].name,
+                what);
+}
+
+//the lookup tables and card sets of the board have to agree with its piles
+static const char *check_board(const Board *board, uint8_t *total) {
+    uint64_t seen = 0, exposed = 0;
+    uint8_t hidden_total = 0, start = 0;
+    *total = 0;
+    for (uint8_t pile = 0; pile < PileCount; pile++) {
+        uint64_t set = 0;
+        uint8_t hidden = 0;
+        if (board->end[pile] < start) return "pile ends out of order";
+        for (uint8_t i = 0; i < board_count(board, pile); i++) {
+            Card card = board_peek_index(board, pile, i);
+            if (card_id(card) >= CARD_COUNT) return "invalid card";
+            if (seen & card_bit(card)) return "card on the board twice";
+            if (board->pile_of[card_id(card)] != pile || board->index_of[card_id(card)] != i)
+                return "card lookup out of date";
+            if (card_is_exposed(card)) exposed |= card_bit(card);
+            else if (hidden++ != i) return "face down card above a face up one";
+            seen |= card_bit(card);
+            set |= card_bit(card);
+        }
+        if (pile >= PileFoundation && pile < PileTableau) {
+            for (uint8_t i = 0; i < board_count(board, pile); i++) {
+                Card below = i ? board_peek_index(board, pile, i - 1) : CARD_NONE;
+                if (!rules_can_found(board_peek_index(board, pile, i), below)) return "foundation out of order";
+            }
+        }
+        if (set != board->pile_set[pile]) return "pile card set out of date";
+        if (hidden != board->hidden[pile]) return "hidden count out of date";
+        hidden_total += hidden;
+        *total += board_count(board, pile);
+        start = board->end[pile];
+    }
+    if (exposed != board->exposed) return "exposed card set out of date";
+    if (hidden_total != board->hidden_total) return "hidden total out of date";
+    return NULL;
+}
+
+static void check_state(GameState *state, uint32_t game, uint64_t frame) {
+    uint8_t total;
+    const char *error = check_board(&state->game.board, &total);
+    if (error) violation(game, frame, error);
+
+    //the flying card of the play screen stays on the board until it lands, the solve screen takes it off
+    if (current_scene == ScenePlay || current_scene == SceneIntro) {
+        if (total != CARD_COUNT) violation(game, frame, "card count is not 52");
+    } else if (current_scene == SceneSolve) {
+        if (total + (state->animated_card.card != CARD_NONE) != CARD_COUNT)
+            violation(game, frame, "card count is not 52");
+    }
+    if (current_scene == ScenePlay) {
+        const Hand *hand = &state->hand;
+        if (hand->count && hand->start + hand->count != board_count(&state->game.board, hand->pile))
+            violation(game, frame, "hand is not the top of its pile");
+        if (state->selected[0] > 6 || state->selected[1] > 1) violation(game, frame, "cursor out of range");
+    }
+}
+
+//one pass of the loop in direct_draw_run, only the frame time is fixed and there is no mutex to take
+static void frame(GameState *instance, bool render) {
+    size_t frame_start = curr_time();
+    instance->delta_time = 1.0 / 60;
+    host_advance_ticks(1000 / 60);
+
+    uint32_t cycles;
+    if (run_frame(instance, frame_start, render, &cycles) && transition_from != SceneNone) {
+        Latency *entry = &latency[transition_from][current_scene];
+        entry->count++;
+        entry->total += cycles;
+        entry->worst = MAX(entry->worst, cycles);
+    }
+
+    uint32_t frame_cost = curr_time() - frame_start;
+    if (frame_cost < FRAME_CYCLES) scheduler_run(&instance->scheduler, FRAME_CYCLES - frame_cost);
+}
+
+//through the input callback of the app, so transitions are timed from the key
+static void press(GameState *state, InputKey key, InputType type) {
+    InputEvent event = {0, key, type};
+    gui_input_events_callback(&event, state);
+}
+
+//not part of play_screen.h, resigning hands the game to the solve screen the way quick solve does
+void end_play_screen(GameState *state);
+
+static void let_go(Bot *bot, GameState *state) {
+    if (bot->held != InputKeyMAX) press(state, bot->held, InputTypeRelease);
+    bot->held = InputKeyMAX;
+}
+
+//directions stay down while they are needed, everything else is a single press
+static void key_down(Bot *bot, GameState *state, InputKey key) {
+    if (bot->held != InputKeyMAX && key == bot->held) {
+        press(state, key, bot->held_long ? InputTypeRepeat : InputTypeLong);
+        if (bot->held_long) bot->repeats++;
+        bot->held_long = true;
+        return;
+    }
+    let_go(bot, state);
+    if (key != InputKeyOk) bot->held = key;
+    bot->held_long = false;
+    bot->presses++;
+    press(state, key, InputTypePress);
+}
+
+static void resign(Bot *bot, GameState *state) {
+    bot->resigned++;
+    end_play_screen(state);
+}
+
+static void plan(Bot *bot, GameState *state) {
+    bot->replans++;
+    bot->plan_count = bot->plan_at = 0;
+    solver_start(bot->solver, &state->game, bot->table, SOLVER_BITS, SOLVER_BUDGET);
+    SolverResult result;
+    while ((result = solver_run(bot->solver, 4096)) == SolverRunning);
+    if (result == SolverSolved) bot->plan_count = solver_solution(bot->solver, bot->plan);
+}
+
+//one key press that brings the cursor closer to column x of row y with count cards selected, Ok once it is there
+static InputKey steer(const GameState *state, uint8_t x, uint8_t y, uint8_t count) {
+    if (state->selected[1] != y) return y ? InputKeyDown : InputKeyUp;
+    if (state->selected[0] != x) return state->selected[0] < x ? InputKeyRight : InputKeyLeft;
+    if (y && state->selected_card != count) return state->selected_card < count ? InputKeyUp : InputKeyDown;
+    return InputKeyOk;
+}
+
+static uint8_t pile_column(uint8_t pile) {
+    if (pile < PileFoundation) return pile;
+    if (pile < PileTableau) return pile - PileFoundation + 3;
+    return pile - PileTableau;
+}
+
+static void player_turn(Bot *bot, GameState *state) {
+    const Klondike *game = &state->game;
+    if (state->hand.count == 0) {
+        if (bot->moves >= PLAYER_PATIENCE) {
+            resign(bot, state);
+            return;
+        }
+        //everything is face up, let the game finish it
+        if (klondike_is_revealed(game) && bot->quick_at != bot->moves) {
+            bot->quick_at = bot->moves;
+            let_go(bot, state);
+            press(state, InputKeyOk, InputTypeLong);
+            return;
+        }
+        if (bot->plan_at >= bot->plan_count || !klondike_is_legal(game, &bot->plan[bot->plan_at])) plan(bot, state);
+        if (bot->plan_at >= bot->plan_count) {
+            resign(bot, state);
+            return;
+        }
+    }
+
+    const Move *move = &bot->plan[bot->plan_at];
+    InputKey key;
+    if (move->type == MoveDraw || move->type == MoveRecycle) {
+        key = steer(state, 0, 0, 1);
+    } else if (move->type == MoveFlip) {
+        key = steer(state, pile_column(move->from), 1, 1);
+    } else if (state->hand.count == 0) {
+        key = steer(state, pile_column(move->from), move->from >= PileTableau, move->count);
+    } else {
+        key = steer(state, pile_column(move->to), move->to >= PileTableau, 1);
+    }
+
+    key_down(bot, state, key);
+    //a pile move is done once the hand is placed, everything else with the first Ok
+    if (key == InputKeyOk && (move->type != MovePile || state->hand.count == 0)) {
+        bot->plan_at++;
+        bot->moves++;
+    }
+}
+
+static void random_turn(Bot *bot, GameState *state) {
+    if (++bot->play_frames > RANDOM_PATIENCE) {
+        resign(bot, state);
+        return;
+    }
+    uint32_t roll = klondike_random(&bot->rng);
+    InputKey key = roll % 5;
+    if (roll / 5 % 40 == 0) press(state, InputKeyBack, InputTypeShort);
+    uint8_t kind = roll / 200 % 10;
+    press(state, key, kind < 7 ? InputTypePress : kind == 7 ? InputTypeLong : kind == 8 ? InputTypeRepeat
+                                                                                        : InputTypeRelease);
+}
+
+static void bot_turn(Bot *bot, GameState *state) {
+    switch (current_scene) {
+        case SceneMain:
+            if (state->deal_mode != bot->mode) press(state, InputKeyUp, InputTypePress);
+            else press(state, InputKeyOk, InputTypePress);
+            break;
+        case ScenePlay:
+            //wait for the cards that fly to the foundations, pressing a key would finish them at once
+            if (state->animated_card.card != CARD_NONE) break;
+            if (bot->type == BotPlayer) player_turn(bot, state);
+            else random_turn(bot, state);
+            break;
+        case SceneResult:
+            press(state, InputKeyOk, InputTypePress);
+            break;
+        default:
+            break;
+    }
+}
+
+static const char *mode_names[DealModeCount] = {"random", "winnable", "daily"};
+
+static double now() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv) {
+    uint32_t games = 100;
+    uint64_t frame_limit = 200000;
+    bool render = true;
+    Bot bot = {0};
+    bot.type = BotPlayer;
+    bot.rng = 1;
+    bot.held = InputKeyMAX;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "g:b:m:rs:f:")) != -1) {
+        switch (opt) {
+            case 'g': games = (uint32_t) strtoul(optarg, NULL, 10); break;
+            case 'b': bot.type = strcmp(optarg, "random") ? BotPlayer : BotRandom; break;
+            case 'm':
+                for (bot.mode = DealModeCount - 1; bot.mode > DealRandom; bot.mode--)
+                    if (!strcmp(optarg, mode_names[bot.mode])) break;
+                break;
+            case 'r': render = false; break;
+            case 's': bot.rng = (uint32_t) strtoul(optarg, NULL, 10) | 1; break;
+            case 'f': frame_limit = strtoull(optarg, NULL, 10); break;
+            default:
+                fprintf(stderr, "usage: %s [-g games] [-b player|random] [-m random|winnable|daily] [-r] [-s seed] "
+                                "[-f frame limit]\n", argv[0]);
+                return 1;
+        }
+    }
+    srand(bot.rng);
+    bot.solver = malloc(sizeof(Solver));
+    bot.table = malloc(SOLVER_TABLE_BYTES(SOLVER_BITS));
+    if (!bot.solver || !bot.table) return 1;
+
+    GameState *state = prepare();
+    uint64_t frames = 0, game_frames = 0, worst = 0;
+    uint32_t played = 0, dailies = 0, rated = 0;
+    bool stuck = false;
+    double start = now();
+
+    while (played < games) {
+        SceneId before = current_scene;
+        bot_turn(&bot, state);
+        frame(state, render);
+        frames++;
+        game_frames++;
+        check_state(state, played, frames);
+
+        if (before == SceneMain && current_scene == SceneIntro) {
+            bot.plan_count = bot.plan_at = bot.moves = 0;
+            bot.quick_at = UINT16_MAX;
+            bot.held = InputKeyMAX;
+            bot.play_frames = 0;
+        }
+        if (before == SceneIntro && current_scene == ScenePlay && state->deal_mode == DealDaily) {
+            dailies++;
+            rated += state->deal_rating != RatingNone;
+        }
+        if (before == SceneResult && current_scene == SceneMain) {
+            played++;
+            if (game_frames > worst) worst = game_frames;
+            game_frames = 0;
+        }
+        if (game_frames > frame_limit) {
+            violation(played, frames, "game did not reach the result screen");
+            stuck = true;
+            break;
+        }
+    }
+    double took = now() - start;
+    cleanup(state);
+
+    printf("%u games, %s bot, %s deals, rendering %s\n", played, bot.type == BotPlayer ? "player" : "random",
+           mode_names[bot.mode], render ? "on" : "off");
+    printf("%.2fs, %.1f games/s, %.0f frames/s\n", took, played / took, frames / took);
+    printf("%.0f frames per game, worst %llu\n", played ? (double) frames / played : 0, (unsigned long long) worst);
+    if (bot.type == BotPlayer)
+        printf("won %u, resigned %u, %u solver runs, %u presses, %u repeats\n", played - bot.resigned, bot.resigned,
+               bot.replans, bot.presses, bot.repeats);
+    else
+        printf("resigned %u\n", bot.resigned);
+    if (dailies) printf("%u of %u daily deals rated before play\n", rated, dailies);
+    if (render) printf("%u frames drawn, %llu pixels\n", host_canvas_frames(),
+                       (unsigned long long) host_canvas_pixels());
+    printf("transition     count  avg us  worst us\n");
+    for (uint8_t from = 0; from < SceneCount; from++) {
+        for (uint8_t to = 0; to < SceneCount; to++) {
+            const Latency *entry = &latency[from][to];
+            if (!entry->count) continue;
+            printf("%-7s> %-7s %5u %7.0f %9.0f\n", scenes[from].name, scenes[to].name, entry->count,
+                   entry->total / 64.0 / entry->count, entry->worst / 64.0);
+        }
+    }
+    printf("%u invariant violations\n", violations);
+    free(bot.table);
+    free(bot.solver);
+    return violations || stuck ? 1 : 0;
+}
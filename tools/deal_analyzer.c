@@ -0,0 +1,295 @@
+//Solves a range of deals on every core and writes one CSV line per seed
+//cc -O2 -pthread -o deal_analyzer tools/deal_analyzer.c src/util/solver.c src/util/klondike.c src/util/board.c
+//   src/util/journal.c src/util/rules.c
+//./deal_analyzer [-n deals] [-s first seed] [-t threads] [-b node budget] [-T table bits] [-o file.csv] [-S]
+//                [-C table.c]
+//deals are shuffled with klondike_deal, the same as the game, -S also reports scaling from 1 to -t threads
+//-C writes the winnable seed table of the game, it is regenerated with
+//./deal_analyzer -n 8192 -b 100000 -T 18 -C src/util/winnable_table.c
+//
+//columns: seed, result (solved, unsolvable or unknown), nodes searched, moves in the solution found (the first
+//one, not the shortest), difficulty bucket (0 easy to 3 very hard, 4 for deals without a known solution)
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "../src/util/solver.h"
+
+//seeds a worker takes at once, small enough that stealing can even out the slow deals at the end
+#define CHUNK 8
+#define SLICE 4096
+
+//node counts where the difficulty buckets end
+static const uint32_t bucket_nodes[] = {2000, 20000, 200000};
+
+typedef struct {
+    uint8_t result;
+    uint8_t bucket;
+    uint16_t moves;
+    uint32_t nodes;
+} DealResult;
+
+//A worker's chunks, the owner takes from the back and thieves from the front
+typedef struct {
+    pthread_mutex_t lock;
+    uint32_t *chunks;
+    uint32_t head;
+    uint32_t tail;
+} Deque;
+
+typedef struct {
+    Deque *deques;
+    uint8_t workers;
+    uint32_t first_seed;
+    uint32_t deals;
+    uint32_t budget;
+    uint8_t table_bits;
+    DealResult *results;
+} Pool;
+
+typedef struct {
+    Pool *pool;
+    uint8_t index;
+    uint32_t steals;
+} Worker;
+
+static double now() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+static bool take_back(Deque *deque, uint32_t *chunk) {
+    pthread_mutex_lock(&deque->lock);
+    bool found = deque->head < deque->tail;
+    if (found) *chunk = deque->chunks[--deque->tail];
+    pthread_mutex_unlock(&deque->lock);
+    return found;
+}
+
+static bool steal_front(Deque *deque, uint32_t *chunk) {
+    pthread_mutex_lock(&deque->lock);
+    bool found = deque->head < deque->tail;
+    if (found) *chunk = deque->chunks[deque->head++];
+    pthread_mutex_unlock(&deque->lock);
+    return found;
+}
+
+//own work first, then every other worker once starting at a random one, nothing left anywhere means done
+static bool next_chunk(Worker *worker, uint32_t *rng, uint32_t *chunk) {
+    Pool *pool = worker->pool;
+    if (take_back(&pool->deques[worker->index], chunk)) return true;
+    uint8_t start = klondike_random(rng) % pool->workers;
+    for (uint8_t i = 0; i < pool->workers; i++) {
+        uint8_t victim = (start + i) % pool->workers;
+        if (victim != worker->index && steal_front(&pool->deques[victim], chunk)) {
+            worker->steals++;
+            return true;
+        }
+    }
+    return false;
+}
+
+static uint8_t difficulty(SolverResult result, uint32_t nodes) {
+    if (result != SolverSolved) return 4;
+    uint8_t bucket = 0;
+    while (bucket < 3 && nodes > bucket_nodes[bucket]) bucket++;
+    return bucket;
+}
+
+static void analyze(Pool *pool, Solver *solver, uint32_t *table, uint32_t seed) {
+    static __thread Move moves[SOLVER_MAX_DEPTH];
+    Klondike game;
+    klondike_deal(&game, seed);
+    solver_start(solver, &game, table, pool->table_bits, pool->budget);
+    SolverResult result;
+    while ((result = solver_run(solver, SLICE)) == SolverRunning);
+
+    DealResult *out = &(pool->results[seed - pool->first_seed]);
+    out->result = result;
+    out->nodes = solver->nodes;
+    out->moves = 0;
+    if (result == SolverSolved) {
+        uint16_t count = solver_solution(solver, moves);
+        if (!solver_verify(&game, moves, count)) {
+            fprintf(stderr, "seed %u: solution does not replay\n", seed);
+            exit(1);
+        }
+        out->moves = count;
+    }
+    out->bucket = difficulty(result, out->nodes);
+}
+
+static void *work(void *data) {
+    Worker *worker = (Worker *) data;
+    Pool *pool = worker->pool;
+    uint32_t *table = malloc(SOLVER_TABLE_BYTES(pool->table_bits));
+    Solver *solver = malloc(sizeof(Solver));
+    if (!table || !solver) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+
+    uint32_t rng = worker->index + 1;
+    uint32_t chunk;
+    while (next_chunk(worker, &rng, &chunk)) {
+        uint32_t first = pool->first_seed + chunk * CHUNK;
+        uint32_t end = first + CHUNK;
+        if (end > pool->first_seed + pool->deals) end = pool->first_seed + pool->deals;
+        for (uint32_t seed = first; seed < end; seed++) analyze(pool, solver, table, seed);
+    }
+    free(solver);
+    free(table);
+    return NULL;
+}
+
+//solves every deal of the pool with the given number of threads, returns the seconds it took
+static double run(Pool *pool, uint8_t workers) {
+    uint32_t chunks = (pool->deals + CHUNK - 1) / CHUNK;
+    pool->workers = workers;
+    pool->deques = calloc(workers, sizeof(Deque));
+    Worker *list = calloc(workers, sizeof(Worker));
+    pthread_t *threads = calloc(workers, sizeof(pthread_t));
+
+    //neighbouring seeds go to different workers so no deque starts with all the hard ones
+    for (uint8_t i = 0; i < workers; i++) {
+        pthread_mutex_init(&pool->deques[i].lock, NULL);
+        pool->deques[i].chunks = malloc(sizeof(uint32_t) * (chunks / workers + 1));
+    }
+    for (uint32_t c = 0; c < chunks; c++) {
+        Deque *deque = &pool->deques[c % workers];
+        deque->chunks[deque->tail++] = c;
+    }
+
+    double start = now();
+    for (uint8_t i = 0; i < workers; i++) {
+        list[i] = (Worker) {pool, i, 0};
+        pthread_create(&threads[i], NULL, work, &list[i]);
+    }
+    uint32_t steals = 0;
+    for (uint8_t i = 0; i < workers; i++) {
+        pthread_join(threads[i], NULL);
+        steals += list[i].steals;
+    }
+    double took = now() - start;
+    fprintf(stderr, "%u threads: %u deals in %.2fs, %.1f deals/s, %u chunks stolen\n", workers, pool->deals, took,
+            pool->deals / took, steals);
+
+    for (uint8_t i = 0; i < workers; i++) {
+        pthread_mutex_destroy(&pool->deques[i].lock);
+        free(pool->deques[i].chunks);
+    }
+    free(pool->deques);
+    free(list);
+    free(threads);
+    return took;
+}
+
+static void write_csv(const Pool *pool, FILE *file) {
+    static const char *names[] = {"unknown", "solved", "unsolvable", "unknown"};
+    fprintf(file, "seed,result,nodes,moves,bucket\n");
+    for (uint32_t i = 0; i < pool->deals; i++) {
+        const DealResult *r = &(pool->results[i]);
+        fprintf(file, "%u,%s,%u,%u,%u\n", pool->first_seed + i, names[r->result], r->nodes, r->moves, r->bucket);
+    }
+}
+
+//2 bits per seed, see winnable_deals.h
+static void write_table(const Pool *pool, FILE *file, int argc, char **argv) {
+    fprintf(file, "//Generated with");
+    for (int i = 0; i < argc; i++) fprintf(file, " %s", i ? argv[i] : "tools/deal_analyzer");
+    fprintf(file, ", do not edit\n#include \"winnable_deals.h\"\n\n");
+    fprintf(file, "const uint32_t winnable_table_seeds = %u;\n\n", pool->deals);
+    fprintf(file, "const uint8_t winnable_table[] = {");
+    for (uint32_t i = 0; i < pool->deals; i += 4) {
+        uint8_t packed = 0;
+        for (uint32_t j = i; j < i + 4 && j < pool->deals; j++) {
+            const DealResult *r = &(pool->results[j]);
+            uint8_t code = r->result == SolverSolved ? 1 + (r->bucket < 2 ? r->bucket : 2) : 0;
+            packed |= code << ((j - i) * 2);
+        }
+        fprintf(file, "%s0x%02x,", i % 64 ? " " : "\n    ", packed);
+    }
+    fprintf(file, "\n};\n");
+}
+
+static void summary(const Pool *pool) {
+    uint32_t counts[3] = {0, 0, 0}, buckets[5] = {0, 0, 0, 0, 0};
+    uint64_t nodes = 0;
+    for (uint32_t i = 0; i < pool->deals; i++) {
+        const DealResult *r = &(pool->results[i]);
+        counts[r->result == SolverSolved ? 0 : r->result == SolverUnsolvable ? 1 : 2]++;
+        buckets[r->bucket]++;
+        nodes += r->nodes;
+    }
+    fprintf(stderr, "solved %u (%.1f%%), unsolvable %u, unknown %u, %llu nodes\n", counts[0],
+            100.0 * counts[0] / pool->deals, counts[1], counts[2], (unsigned long long) nodes);
+    fprintf(stderr, "buckets: %u easy, %u medium, %u hard, %u very hard, %u no solution\n", buckets[0], buckets[1],
+            buckets[2], buckets[3], buckets[4]);
+}
+
+int main(int argc, char **argv) {
+    Pool pool = {NULL, 0, 0, 10000, 200000, 18, NULL};
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    uint8_t threads = cores > 0 && cores < 255 ? (uint8_t) cores : 1;
+    const char *output = NULL, *table = NULL;
+    bool scaling = false;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:t:b:T:o:SC:")) != -1) {
+        switch (opt) {
+            case 'n': pool.deals = (uint32_t) strtoul(optarg, NULL, 10); break;
+            case 's': pool.first_seed = (uint32_t) strtoul(optarg, NULL, 10); break;
+            case 't': threads = (uint8_t) atoi(optarg); break;
+            case 'b': pool.budget = (uint32_t) strtoul(optarg, NULL, 10); break;
+            case 'T': pool.table_bits = (uint8_t) atoi(optarg); break;
+            case 'o': output = optarg; break;
+            case 'S': scaling = true; break;
+            case 'C': table = optarg; break;
+            default:
+                fprintf(stderr, "usage: %s [-n deals] [-s first seed] [-t threads] [-b node budget] "
+                                "[-T table bits] [-o file.csv] [-S] [-C table.c]\n", argv[0]);
+                return 1;
+        }
+    }
+    if (!pool.deals || !threads) return 1;
+    if (table && pool.first_seed) {
+        fprintf(stderr, "the seed table starts at seed 0\n");
+        return 1;
+    }
+    pool.results = calloc(pool.deals, sizeof(DealResult));
+    if (!pool.results) return 1;
+
+    double took = run(&pool, threads);
+    if (scaling) {
+        //the same deals again with 1, 2, 4 ... threads, efficiency is the speedup divided by the thread count
+        double single = threads > 1 ? run(&pool, 1) : took;
+        fprintf(stderr, "threads,seconds,speedup,efficiency\n");
+        for (unsigned n = 1; n <= threads; n = n < threads && n * 2 > threads ? threads : n * 2) {
+            double t = n == 1 ? single : n == threads ? took : run(&pool, n);
+            fprintf(stderr, "%u,%.2f,%.2f,%.2f\n", n, t, single / t, single / t / n);
+            if (n == threads) break;
+        }
+    }
+
+    summary(&pool);
+    if (table) {
+        FILE *file = fopen(table, "w");
+        if (!file) return 1;
+        write_table(&pool, file, argc, argv);
+        fclose(file);
+        if (!output) {
+            free(pool.results);
+            return 0;
+        }
+    }
+    FILE *file = output ? fopen(output, "w") : stdout;
+    if (!file) return 1;
+    write_csv(&pool, file);
+    if (output) fclose(file);
+    free(pool.results);
+    return 0;
+}
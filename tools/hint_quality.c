@@ -0,0 +1,92 @@
+//Compares the bounded on-device hint with a full search from the same position
+//cc -O2 -o hint_quality tools/hint_quality.c src/util/hint.c src/util/solver.c src/util/klondike.c
+//   src/util/board.c src/util/journal.c src/util/rules.c && ./hint_quality [deals]
+//positions are sampled along full solutions, so each of them can still be won. A hint is good when the full search
+//can still win after playing it
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../src/util/hint.h"
+
+#define FULL_BUDGET 2000000
+#define FULL_TABLE_BITS 20
+//every SAMPLE_EVERY moves of a solution is checked
+#define SAMPLE_EVERY 12
+
+static uint32_t *table;
+static Solver *full;
+
+static double now() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+static SolverResult solve(const Klondike *game) {
+    solver_start(full, game, table, FULL_TABLE_BITS, FULL_BUDGET);
+    SolverResult result;
+    while ((result = solver_run(full, 4096)) == SolverRunning);
+    return result;
+}
+
+static bool same_move(const Move *a, const Move *b) {
+    return a->type == b->type && a->from == b->from && (a->type != MovePile || (a->to == b->to && a->count == b->count));
+}
+
+int main(int argc, char **argv) {
+    uint32_t deals = argc > 1 ? (uint32_t) atoi(argv[1]) : 40;
+    table = malloc(SOLVER_TABLE_BYTES(FULL_TABLE_BITS));
+    full = malloc(sizeof(Solver));
+    Hint *hint = malloc(sizeof(Hint));
+    static Move solution[SOLVER_MAX_DEPTH];
+    if (!table || !full || !hint) return 1;
+
+    uint32_t positions = 0, answered = 0, winnable = 0, lost = 0, unknown = 0, matching = 0, steps = 0;
+    uint64_t nodes = 0;
+    double hint_time = 0;
+    Klondike game, probe;
+
+    for (uint32_t seed = 0; seed < deals; seed++) {
+        klondike_deal(&game, seed);
+        if (solve(&game) != SolverSolved) continue;
+        uint16_t length = solver_solution(full, solution);
+
+        for (uint16_t at = 0; at < length; at++) {
+            if (at % SAMPLE_EVERY == 0) {
+                positions++;
+                double start = now();
+                hint_start(hint, &game);
+                while (!hint_step(hint)) steps++;
+                steps++;
+                hint_time += now() - start;
+                nodes += hint->solver.nodes;
+
+                Move move;
+                if (hint_move(hint, &move) && klondike_is_legal(&game, &move)) {
+                    answered++;
+                    if (same_move(&move, &solution[at])) matching++;
+                    probe = game;
+                    klondike_apply_move(&probe, &move);
+                    SolverResult result = solve(&probe);
+                    if (result == SolverSolved) winnable++;
+                    else if (result == SolverUnsolvable) lost++;
+                    else unknown++;
+                }
+            }
+            klondike_apply_move(&game, &solution[at]);
+        }
+    }
+
+    printf("%u positions from winnable deals, %u answered\n", positions, answered);
+    printf("still winnable after the hint %u (%.1f%%), lost %u, unknown %u\n", winnable,
+           answered ? 100.0 * winnable / answered : 0, lost, unknown);
+    printf("same move as the full solution %u (%.1f%%)\n", matching, answered ? 100.0 * matching / answered : 0);
+    printf("%.0f nodes and %.1f scheduler steps per hint, %.2fms per hint on this host\n",
+           positions ? (double) nodes / positions : 0, positions ? (double) steps / positions : 0,
+           positions ? hint_time * 1000 / positions : 0);
+    free(hint);
+    free(full);
+    free(table);
+    return 0;
+}
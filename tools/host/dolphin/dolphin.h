@@ -0,0 +1,8 @@
+#pragma once
+
+typedef enum {
+    DolphinDeedPluginGameStart,
+    DolphinDeedPluginGameWin,
+} DolphinDeed;
+
+void dolphin_deed(DolphinDeed deed);
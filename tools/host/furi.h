@@ -0,0 +1,115 @@
+#pragma once
+
+//Just enough of the furi API to build the platform independent parts of the app on a desktop
+//tools that run the scenes also link tools/host/host.c for the functions below
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+
+#define UNUSED(x) (void) (x)
+
+#ifndef MAX
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#endif
+#ifndef MIN
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#endif
+
+#define FURI_LOG_E(tag, format, ...) fprintf(stderr, "[E][%s] " format "\n", tag, ##__VA_ARGS__)
+#define FURI_LOG_W(tag, format, ...) fprintf(stderr, "[W][%s] " format "\n", tag, ##__VA_ARGS__)
+//info and debug logs stay quiet, their arguments are still checked against the format like on the device
+#define FURI_LOG_I(tag, format, ...) \
+    do { if (0) fprintf(stderr, "[I][%s] " format "\n", tag, ##__VA_ARGS__); } while (0)
+#define FURI_LOG_D(tag, format, ...) \
+    do { if (0) fprintf(stderr, "[D][%s] " format "\n", tag, ##__VA_ARGS__); } while (0)
+
+#define FURI_CRITICAL_ENTER() do {} while (0)
+#define FURI_CRITICAL_EXIT() do {} while (0)
+#define furi_assert(x) UNUSED(x)
+#define furi_check(x) UNUSED(x)
+
+//curr_time() reads the cycle counter, on the desktop it follows the monotonic clock at the 64MHz of the device
+typedef struct {
+    uint32_t CYCCNT;
+} DWT_Type;
+
+static inline DWT_Type *host_dwt(void) {
+    static DWT_Type dwt;
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    dwt.CYCCNT = (uint32_t) ((uint64_t) t.tv_sec * 64000000 + t.tv_nsec * 64 / 1000);
+    return &dwt;
+}
+
+#define DWT (host_dwt())
+
+typedef enum {
+    FuriStatusOk = 0,
+    FuriStatusError = -1,
+    FuriStatusErrorTimeout = -2,
+} FuriStatus;
+
+#define FuriWaitForever 0xFFFFFFFFU
+
+#define RECORD_INPUT_EVENTS "input_events"
+#define RECORD_GUI "gui"
+#define RECORD_NOTIFICATION "notification"
+
+//the tick count only moves when the host tool says so, see host_advance_ticks
+uint32_t furi_get_tick(void);
+uint32_t furi_kernel_get_tick_frequency(void);
+uint32_t furi_ms_to_ticks(uint32_t ms);
+void host_advance_ticks(uint32_t ticks);
+
+typedef struct FuriMutex FuriMutex;
+typedef enum {
+    FuriMutexTypeNormal,
+    FuriMutexTypeRecursive,
+} FuriMutexType;
+
+FuriMutex *furi_mutex_alloc(FuriMutexType type);
+void furi_mutex_free(FuriMutex *mutex);
+FuriStatus furi_mutex_acquire(FuriMutex *mutex, uint32_t timeout);
+FuriStatus furi_mutex_release(FuriMutex *mutex);
+
+void *furi_record_open(const char *name);
+void furi_record_close(const char *name);
+
+typedef struct FuriPubSub FuriPubSub;
+typedef struct FuriPubSubSubscription FuriPubSubSubscription;
+typedef void (*FuriPubSubCallback)(const void *message, void *context);
+
+FuriPubSubSubscription *furi_pubsub_subscribe(FuriPubSub *pubsub, FuriPubSubCallback callback, void *context);
+void furi_pubsub_unsubscribe(FuriPubSub *pubsub, FuriPubSubSubscription *subscription);
+
+typedef void *FuriThreadId;
+typedef enum {
+    FuriThreadPriorityIdle = 1,
+    FuriThreadPriorityNormal = 16,
+} FuriThreadPriority;
+
+void furi_thread_set_current_priority(FuriThreadPriority priority);
+void furi_thread_yield(void);
+FuriThreadId furi_thread_get_current_id(void);
+uint32_t furi_thread_get_stack_space(FuriThreadId thread);
+
+//timers never fire on the desktop
+typedef struct FuriTimer FuriTimer;
+typedef void (*FuriTimerCallback)(void *context);
+typedef enum {
+    FuriTimerTypeOnce,
+    FuriTimerTypePeriodic,
+} FuriTimerType;
+
+FuriTimer *furi_timer_alloc(FuriTimerCallback callback, FuriTimerType type, void *context);
+void furi_timer_free(FuriTimer *timer);
+FuriStatus furi_timer_start(FuriTimer *timer, uint32_t ticks);
+FuriStatus furi_timer_stop(FuriTimer *timer);
+
+size_t memmgr_get_free_heap(void);
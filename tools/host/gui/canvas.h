@@ -0,0 +1,43 @@
+#pragma once
+
+#include <furi.h>
+
+//Draw calls only count the pixels they would touch, so rendering still costs something on the desktop
+
+typedef struct Canvas Canvas;
+
+typedef enum {
+    ColorWhite,
+    ColorBlack,
+    ColorXOR,
+} Color;
+
+typedef enum {
+    FontPrimary,
+    FontSecondary,
+    FontKeyboard,
+    FontBigNumbers,
+} Font;
+
+typedef enum {
+    AlignLeft,
+    AlignRight,
+    AlignTop,
+    AlignBottom,
+    AlignCenter,
+} Align;
+
+void canvas_reset(Canvas *canvas);
+void canvas_commit(Canvas *canvas);
+void canvas_set_color(Canvas *canvas, Color color);
+void canvas_set_font(Canvas *canvas, Font font);
+void canvas_draw_dot(Canvas *canvas, int32_t x, int32_t y);
+void canvas_draw_box(Canvas *canvas, int32_t x, int32_t y, size_t width, size_t height);
+void canvas_draw_frame(Canvas *canvas, int32_t x, int32_t y, size_t width, size_t height);
+void canvas_draw_str(Canvas *canvas, int32_t x, int32_t y, const char *str);
+void canvas_draw_str_aligned(Canvas *canvas, int32_t x, int32_t y, Align horizontal, Align vertical, const char *str);
+void canvas_draw_xbm(Canvas *canvas, int32_t x, int32_t y, size_t width, size_t height, const uint8_t *bitmap);
+
+//pixels drawn and frames committed since the start
+uint64_t host_canvas_pixels(void);
+uint32_t host_canvas_frames(void);
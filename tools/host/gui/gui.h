@@ -0,0 +1,8 @@
+#pragma once
+
+#include <gui/canvas.h>
+
+typedef struct Gui Gui;
+
+Canvas *gui_direct_draw_acquire(Gui *gui);
+void gui_direct_draw_release(Gui *gui);
@@ -0,0 +1,234 @@
+//Desktop stand-ins for the furi, gui, notification and dolphin services the scenes use
+//every service is a no-op, except that the canvas counts what it draws, the tick count is moved by the tool and the
+//clock is the one of the desktop
+
+#include <furi.h>
+#include <furi_hal.h>
+#include <gui/gui.h>
+#include <notification/notification_messages.h>
+#include <dolphin/dolphin.h>
+
+static uint32_t ticks = 0;
+static uint64_t pixels = 0;
+static uint32_t frames = 0;
+
+uint32_t furi_get_tick(void) {
+    return ticks;
+}
+
+uint32_t furi_kernel_get_tick_frequency(void) {
+    return 1000;
+}
+
+uint32_t furi_ms_to_ticks(uint32_t ms) {
+    return ms;
+}
+
+void host_advance_ticks(uint32_t count) {
+    ticks += count;
+}
+
+//single threaded, any non-NULL handle will do
+FuriMutex *furi_mutex_alloc(FuriMutexType type) {
+    UNUSED(type);
+    return (FuriMutex *) malloc(1);
+}
+
+void furi_mutex_free(FuriMutex *mutex) {
+    free(mutex);
+}
+
+FuriStatus furi_mutex_acquire(FuriMutex *mutex, uint32_t timeout) {
+    UNUSED(mutex);
+    UNUSED(timeout);
+    return FuriStatusOk;
+}
+
+FuriStatus furi_mutex_release(FuriMutex *mutex) {
+    UNUSED(mutex);
+    return FuriStatusOk;
+}
+
+void *furi_record_open(const char *name) {
+    UNUSED(name);
+    return NULL;
+}
+
+void furi_record_close(const char *name) {
+    UNUSED(name);
+}
+
+//input is delivered by calling the scene input functions directly
+FuriPubSubSubscription *furi_pubsub_subscribe(FuriPubSub *pubsub, FuriPubSubCallback callback, void *context) {
+    UNUSED(pubsub);
+    UNUSED(callback);
+    UNUSED(context);
+    return NULL;
+}
+
+void furi_pubsub_unsubscribe(FuriPubSub *pubsub, FuriPubSubSubscription *subscription) {
+    UNUSED(pubsub);
+    UNUSED(subscription);
+}
+
+void furi_thread_set_current_priority(FuriThreadPriority priority) {
+    UNUSED(priority);
+}
+
+void furi_thread_yield(void) {
+}
+
+FuriThreadId furi_thread_get_current_id(void) {
+    return NULL;
+}
+
+uint32_t furi_thread_get_stack_space(FuriThreadId thread) {
+    UNUSED(thread);
+    return 0;
+}
+
+FuriTimer *furi_timer_alloc(FuriTimerCallback callback, FuriTimerType type, void *context) {
+    UNUSED(callback);
+    UNUSED(type);
+    UNUSED(context);
+    return (FuriTimer *) malloc(1);
+}
+
+void furi_timer_free(FuriTimer *timer) {
+    free(timer);
+}
+
+FuriStatus furi_timer_start(FuriTimer *timer, uint32_t count) {
+    UNUSED(timer);
+    UNUSED(count);
+    return FuriStatusOk;
+}
+
+FuriStatus furi_timer_stop(FuriTimer *timer) {
+    UNUSED(timer);
+    return FuriStatusOk;
+}
+
+void furi_hal_rtc_get_datetime(DateTime *datetime) {
+    time_t now = time(NULL);
+    struct tm *local = localtime(&now);
+    datetime->hour = local->tm_hour;
+    datetime->minute = local->tm_min;
+    datetime->second = local->tm_sec;
+    datetime->day = local->tm_mday;
+    datetime->month = local->tm_mon + 1;
+    datetime->year = local->tm_year + 1900;
+    datetime->weekday = local->tm_wday ? local->tm_wday : 7;
+}
+
+size_t memmgr_get_free_heap(void) {
+    return 0;
+}
+
+//the canvas is never dereferenced, it only has to be non-NULL for the frame loop
+Canvas *gui_direct_draw_acquire(Gui *gui) {
+    UNUSED(gui);
+    static uint8_t canvas;
+    return (Canvas *) &canvas;
+}
+
+void gui_direct_draw_release(Gui *gui) {
+    UNUSED(gui);
+}
+
+void canvas_reset(Canvas *canvas) {
+    UNUSED(canvas);
+}
+
+void canvas_commit(Canvas *canvas) {
+    UNUSED(canvas);
+    frames++;
+}
+
+void canvas_set_color(Canvas *canvas, Color color) {
+    UNUSED(canvas);
+    UNUSED(color);
+}
+
+void canvas_set_font(Canvas *canvas, Font font) {
+    UNUSED(canvas);
+    UNUSED(font);
+}
+
+void canvas_draw_dot(Canvas *canvas, int32_t x, int32_t y) {
+    UNUSED(canvas);
+    UNUSED(x);
+    UNUSED(y);
+    pixels++;
+}
+
+void canvas_draw_box(Canvas *canvas, int32_t x, int32_t y, size_t width, size_t height) {
+    UNUSED(canvas);
+    UNUSED(x);
+    UNUSED(y);
+    pixels += width * height;
+}
+
+void canvas_draw_frame(Canvas *canvas, int32_t x, int32_t y, size_t width, size_t height) {
+    UNUSED(canvas);
+    UNUSED(x);
+    UNUSED(y);
+    pixels += (width + height) * 2;
+}
+
+void canvas_draw_str(Canvas *canvas, int32_t x, int32_t y, const char *str) {
+    UNUSED(canvas);
+    UNUSED(x);
+    UNUSED(y);
+    pixels += strlen(str) * 35;
+}
+
+void canvas_draw_str_aligned(Canvas *canvas, int32_t x, int32_t y, Align horizontal, Align vertical, const char *str) {
+    UNUSED(horizontal);
+    UNUSED(vertical);
+    canvas_draw_str(canvas, x, y, str);
+}
+
+void canvas_draw_xbm(Canvas *canvas, int32_t x, int32_t y, size_t width, size_t height, const uint8_t *bitmap) {
+    UNUSED(canvas);
+    UNUSED(x);
+    UNUSED(y);
+    UNUSED(bitmap);
+    pixels += width * height;
+}
+
+uint64_t host_canvas_pixels(void) {
+    return pixels;
+}
+
+uint32_t host_canvas_frames(void) {
+    return frames;
+}
+
+void notification_message(NotificationApp *app, const NotificationSequence *sequence) {
+    UNUSED(app);
+    UNUSED(sequence);
+}
+
+void notification_message_block(NotificationApp *app, const NotificationSequence *sequence) {
+    UNUSED(app);
+    UNUSED(sequence);
+}
+
+const NotificationMessage message_vibro_on = {NotificationMessageTypeVibro, {.vibro = {true}}};
+const NotificationMessage message_vibro_off = {NotificationMessageTypeVibro, {.vibro = {false}}};
+const NotificationMessage message_sound_off = {NotificationMessageTypeSoundOff, {.sound = {0, 0}}};
+const NotificationMessage message_delay_10 = {NotificationMessageTypeDelay, {.delay = {10}}};
+const NotificationMessage message_delay_100 = {NotificationMessageTypeDelay, {.delay = {100}}};
+const NotificationMessage message_note_a3 = {NotificationMessageTypeSoundOn, {.sound = {220.0f, 1}}};
+const NotificationMessage message_note_c4 = {NotificationMessageTypeSoundOn, {.sound = {261.63f, 1}}};
+const NotificationMessage message_note_e4 = {NotificationMessageTypeSoundOn, {.sound = {329.63f, 1}}};
+const NotificationMessage message_note_g4 = {NotificationMessageTypeSoundOn, {.sound = {392.0f, 1}}};
+const NotificationMessage message_note_a4 = {NotificationMessageTypeSoundOn, {.sound = {440.0f, 1}}};
+
+const NotificationSequence sequence_display_backlight_enforce_on = {NULL};
+const NotificationSequence sequence_display_backlight_enforce_auto = {NULL};
+
+void dolphin_deed(DolphinDeed deed) {
+    UNUSED(deed);
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <furi.h>
+
+//Messages are accepted and dropped, there is no sound or vibration on the desktop
+
+typedef struct NotificationApp NotificationApp;
+
+typedef enum {
+    NotificationMessageTypeVibro,
+    NotificationMessageTypeSoundOn,
+    NotificationMessageTypeSoundOff,
+    NotificationMessageTypeDelay,
+    NotificationMessageTypeDoNotReset,
+} NotificationMessageType;
+
+typedef struct {
+    float frequency;
+    float volume;
+} NotificationMessageDataSound;
+
+typedef struct {
+    bool on;
+} NotificationMessageDataVibro;
+
+typedef struct {
+    uint32_t length;
+} NotificationMessageDataDelay;
+
+typedef union {
+    NotificationMessageDataSound sound;
+    NotificationMessageDataVibro vibro;
+    NotificationMessageDataDelay delay;
+} NotificationMessageData;
+
+typedef struct {
+    NotificationMessageType type;
+    NotificationMessageData data;
+} NotificationMessage;
+
+typedef const NotificationMessage *NotificationSequence[];
+
+void notification_message(NotificationApp *app, const NotificationSequence *sequence);
+void notification_message_block(NotificationApp *app, const NotificationSequence *sequence);
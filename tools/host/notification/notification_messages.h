@@ -0,0 +1,17 @@
+#pragma once
+
+#include <notification/notification.h>
+
+extern const NotificationMessage message_vibro_on;
+extern const NotificationMessage message_vibro_off;
+extern const NotificationMessage message_sound_off;
+extern const NotificationMessage message_delay_10;
+extern const NotificationMessage message_delay_100;
+extern const NotificationMessage message_note_a3;
+extern const NotificationMessage message_note_c4;
+extern const NotificationMessage message_note_e4;
+extern const NotificationMessage message_note_g4;
+extern const NotificationMessage message_note_a4;
+
+extern const NotificationSequence sequence_display_backlight_enforce_on;
+extern const NotificationSequence sequence_display_backlight_enforce_auto;
@@ -0,0 +1,110 @@
+//Random playouts on the rules engine, reports how many moves it can generate, apply and undo per second
+//cc -O2 -o klondike_bench tools/klondike_bench.c src/util/klondike.c src/util/board.c src/util/journal.c
+//   src/util/rules.c && ./klondike_bench [games] [check]
+//with check every generated move list is compared to a brute force search with klondike_is_legal
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../src/util/klondike.h"
+
+//moves per game before it is given up, random play rarely finishes
+#define PLAYOUT_LENGTH 400
+//one in UNDO_CHANCE steps takes a move back instead
+#define UNDO_CHANCE 4
+
+static double now() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+static uint8_t move_key(const Move *move) {
+    return move->type * PileCount * PileCount + move->from * PileCount + move->to;
+}
+
+//every move klondike_is_legal accepts must be generated exactly once with the same count, and nothing else
+static bool check_moves(const Klondike *game, const Move *moves, uint8_t count) {
+    static uint8_t generated[4 * PileCount * PileCount];
+    memset(generated, 0, sizeof(generated));
+    for (uint8_t i = 0; i < count; i++) {
+        if (!klondike_is_legal(game, &moves[i]) || generated[move_key(&moves[i])]++) return false;
+    }
+
+    //draw, recycle and flip only have one shape each
+    uint8_t legal = 0;
+    Move move = {MoveDraw, PileDeck, PileWaste, 1};
+    if (klondike_is_legal(game, &move) && !generated[move_key(&move)]) return false;
+    legal += klondike_is_legal(game, &move);
+    move = (Move) {MoveRecycle, PileWaste, PileDeck, 0};
+    if (klondike_is_legal(game, &move) && !generated[move_key(&move)]) return false;
+    legal += klondike_is_legal(game, &move);
+    for (move.from = 0; move.from < PileCount; move.from++) {
+        move.type = MoveFlip;
+        move.to = move.from;
+        if (klondike_is_legal(game, &move) && !generated[move_key(&move)]) return false;
+        legal += klondike_is_legal(game, &move);
+
+        move.type = MovePile;
+        for (move.to = 0; move.to < PileCount; move.to++) {
+            uint8_t found = 0;
+            for (move.count = 1; move.count <= CARD_COUNT; move.count++) {
+                if (!klondike_is_legal(game, &move)) continue;
+                if (!generated[move_key(&move)]) return false;
+                found++;
+            }
+            //a run is ordered, so a pile move has one legal count at most
+            if (found > 1) return false;
+            legal += found;
+        }
+    }
+    return legal == count;
+}
+
+int main(int argc, char **argv) {
+    uint32_t games = argc > 1 ? (uint32_t) atoi(argv[1]) : 20000;
+    bool check = argc > 2 && strcmp(argv[2], "check") == 0;
+    uint64_t generated = 0, applied = 0, undone = 0, won = 0, stuck = 0, positions = 0, mismatches = 0;
+    uint32_t rng = 1;
+    Klondike game;
+    Move moves[KLONDIKE_MAX_MOVES];
+
+    double start = now();
+    for (uint32_t seed = 0; seed < games; seed++) {
+        klondike_deal(&game, seed);
+        for (uint16_t step = 0; step < PLAYOUT_LENGTH; step++) {
+            if (klondike_random(&rng) % UNDO_CHANCE == 0 && klondike_undo_move(&game)) {
+                undone++;
+                continue;
+            }
+            uint8_t count = klondike_generate_moves(&game, moves);
+            generated += count;
+            positions++;
+            if (check && !check_moves(&game, moves, count)) mismatches++;
+            if (!count) {
+                stuck++;
+                break;
+            }
+            klondike_apply_move(&game, &moves[klondike_random(&rng) % count]);
+            applied++;
+            if (klondike_is_won(&game)) {
+                won++;
+                break;
+            }
+        }
+    }
+    double took = now() - start;
+
+    printf("%u games in %.2fs, %llu won, %llu without moves\n", games, took, (unsigned long long) won,
+           (unsigned long long) stuck);
+    printf("applied %llu moves (%.0f/s), undone %llu (%.0f/s), generated %llu (%.0f/s)\n",
+           (unsigned long long) applied, applied / took, (unsigned long long) undone, undone / took,
+           (unsigned long long) generated, generated / took);
+    printf("apply + undo %.0f/s, %.0f positions/s\n", (applied + undone) / took, positions / took);
+    if (check) {
+        printf("checked %llu positions, %llu mismatches\n", (unsigned long long) positions,
+               (unsigned long long) mismatches);
+    }
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,76 @@
+//Runs the solver over a fixed corpus of seeds and reports the solve rate and search speed
+//cc -O2 -o solver_bench tools/solver_bench.c src/util/solver.c src/util/klondike.c src/util/board.c
+//   src/util/journal.c src/util/rules.c && ./solver_bench [deals] [table bits] [node budget] [ms per deal]
+//seeds 0 to deals - 1 are dealt with klondike_deal, every solution found is replayed with solver_verify before it
+//is counted
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../src/util/solver.h"
+
+//nodes per solver_run call, the same slicing the device would use
+#define SLICE 4096
+
+static double now() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv) {
+    uint32_t deals = argc > 1 ? (uint32_t) atoi(argv[1]) : 200;
+    uint8_t bits = argc > 2 ? (uint8_t) atoi(argv[2]) : 20;
+    uint32_t budget = argc > 3 ? (uint32_t) atoi(argv[3]) : 2000000;
+    double time_limit = (argc > 4 ? atoi(argv[4]) : 2000) / 1000.0;
+
+    uint32_t *table = malloc(SOLVER_TABLE_BYTES(bits));
+    Solver *solver = malloc(sizeof(Solver));
+    if (!table || !solver) return 1;
+
+    uint32_t solved = 0, unsolvable = 0, gave_up = 0, invalid = 0;
+    uint64_t nodes = 0, solution_moves = 0;
+    Klondike game;
+    static Move moves[SOLVER_MAX_DEPTH];
+
+    double start = now();
+    for (uint32_t seed = 0; seed < deals; seed++) {
+        klondike_deal(&game, seed);
+        solver_start(solver, &game, table, bits, budget);
+        SolverResult result;
+        double deal_start = now();
+        while ((result = solver_run(solver, SLICE)) == SolverRunning) {
+            if (now() - deal_start > time_limit) {
+                result = SolverGaveUp;
+                break;
+            }
+        }
+        nodes += solver->nodes;
+
+        if (result == SolverSolved) {
+            uint16_t count = solver_solution(solver, moves);
+            if (solver_verify(&game, moves, count)) {
+                solved++;
+                solution_moves += count;
+            } else {
+                invalid++;
+                printf("seed %u: solution does not replay\n", seed);
+            }
+        } else if (result == SolverUnsolvable) {
+            unsolvable++;
+        } else {
+            gave_up++;
+        }
+    }
+    double took = now() - start;
+
+    printf("%u deals in %.2fs, table %u KB, budget %u nodes or %.1fs\n", deals, took,
+           (unsigned) (SOLVER_TABLE_BYTES(bits) / 1024), budget, time_limit);
+    printf("solved %u (%.1f%%), unsolvable %u, gave up %u, invalid %u\n", solved, 100.0 * solved / deals,
+           unsolvable, gave_up, invalid);
+    printf("%llu nodes, %.0f nodes/s, %.1f moves per solution\n", (unsigned long long) nodes, nodes / took,
+           solved ? (double) solution_moves / solved : 0);
+    free(solver);
+    free(table);
+    return invalid ? 1 : 0;
+}